@@ -0,0 +1,184 @@
+/**
+ * Equivalence checker for MS5611 compensation paths.
+ *
+ * Sweeps every D2 value and a D1 grid for a set of PROM coefficient sets, comparing a candidate
+ * compensation against reference formulas transcribed from the original MS5611::readPressure() and
+ * MS5611::readTemperature() (with the second order temperature applied below 20 °C only, as in the
+ * datasheet). It reports mismatches and the maximum absolute error with and without second order
+ * compensation, and the first order deviation from the exact real-valued formula. The D2 range is
+ * split across all hardware threads; the datasheet PROM set comes first, the rest are random.
+ *
+ * Build and run on the host:
+ *
+ *     g++ -O2 -std=c++11 -pthread equivalence.cpp -o equivalence
+ *     ./equivalence [prom sets] [D1 step] [seed]
+ *
+ * To evaluate a new fast path, change candidatePressure() and candidateTemperature().
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <thread>
+#include <vector>
+
+#include "../../src/MS5611Compensation.h"
+
+struct Result {
+    uint64_t evaluations;
+    uint64_t pressureMismatches;
+    uint64_t temperatureMismatches;
+    int64_t maximumPressureError;
+    int64_t maximumTemperatureError;
+    double maximumIdealError;
+};
+
+static int32_t candidatePressure(const uint16_t *coefficients, uint32_t D1, uint32_t D2, bool compensation) {
+    return MS5611Compensation<MS5611Policy>::pressure(coefficients, D1, D2, compensation);
+}
+
+static int32_t candidateTemperature(const uint16_t *coefficients, uint32_t D2, bool compensation) {
+    return MS5611Compensation<MS5611Policy>::temperature(coefficients, D2, compensation);
+}
+
+static int32_t referencePressure(const uint16_t *coefficients, uint32_t D1, uint32_t D2, bool compensation) {
+    int32_t dT = D2 - (uint32_t)coefficients[4] * 256;
+
+    int64_t offset = (int64_t)coefficients[1] * 65536 + (int64_t)coefficients[3] * dT / 128;
+    int64_t sensitivity = (int64_t)coefficients[0] * 32768 + (int64_t)coefficients[2] * dT / 256;
+
+    if(compensation) {
+        int64_t temperature = 2000 + ((int64_t)dT * coefficients[5]) / 8388608;
+        int64_t offset2 = 0;
+        int64_t sensitivity2 = 0;
+        if(temperature < 2000) {
+            offset2 = 5 * ((temperature - 2000) * (temperature - 2000)) / 2;
+            sensitivity2 = 5 * ((temperature - 2000) * (temperature - 2000)) / 4;
+        }
+        if(temperature < -1500) {
+            offset2 = offset2 + 7 * ((temperature + 1500) * (temperature + 1500));
+            sensitivity2 = sensitivity2 + 11 * ((temperature + 1500) * (temperature + 1500)) / 2;
+        }
+        offset = offset - offset2;
+        sensitivity = sensitivity - sensitivity2;
+    }
+
+    return (int32_t)((D1 * sensitivity / 2097152 - offset) / 32768);
+}
+
+static int32_t referenceTemperature(const uint16_t *coefficients, uint32_t D2, bool compensation) {
+    int32_t dT = D2 - (uint32_t)coefficients[4] * 256;
+    int32_t temperature = 2000 + ((int64_t)dT * coefficients[5]) / 8388608;
+    int32_t temperature2 = 0;
+    if(compensation && temperature < 2000) {
+        temperature2 = ((int64_t)dT * dT) / 2147483648LL;
+    }
+    return temperature - temperature2;
+}
+
+static double idealPressure(const uint16_t *coefficients, uint32_t D1, uint32_t D2) {
+    double dT = (double)D2 - coefficients[4] * 256.0;
+    double offset = coefficients[1] * 65536.0 + coefficients[3] * dT / 128.0;
+    double sensitivity = coefficients[0] * 32768.0 + coefficients[2] * dT / 256.0;
+    return (D1 * sensitivity / 2097152.0 - offset) / 32768.0;
+}
+
+static void sweep(const uint16_t *coefficients, uint32_t first, uint32_t last, uint32_t step, Result &result) {
+    Result local = { 0, 0, 0, 0, 0, 0.0 };
+    for(uint32_t D2 = first; D2 < last; D2++) {
+        for(int compensation = 0; compensation < 2; compensation++) {
+            int64_t temperatureError = (int64_t)candidateTemperature(coefficients, D2, compensation) - referenceTemperature(coefficients, D2, compensation);
+            if(temperatureError != 0) {
+                local.temperatureMismatches++;
+                if(llabs(temperatureError) > local.maximumTemperatureError) {
+                    local.maximumTemperatureError = llabs(temperatureError);
+                }
+            }
+        }
+
+        for(uint64_t D1 = 0; D1 < (1UL << 24); D1 += step) {
+            uint32_t value = D1 + step >= (1UL << 24) ? (1UL << 24) - 1 : (uint32_t)D1;
+            for(int compensation = 0; compensation < 2; compensation++) {
+                int32_t candidate = candidatePressure(coefficients, value, D2, compensation);
+                int64_t error = (int64_t)candidate - referencePressure(coefficients, value, D2, compensation);
+                local.evaluations++;
+                if(error != 0) {
+                    local.pressureMismatches++;
+                    if(llabs(error) > local.maximumPressureError) {
+                        local.maximumPressureError = llabs(error);
+                    }
+                }
+                if(!compensation) {
+                    double idealError = fabs(candidate - idealPressure(coefficients, value, D2));
+                    if(idealError > local.maximumIdealError) {
+                        local.maximumIdealError = idealError;
+                    }
+                }
+            }
+        }
+    }
+    result = local;
+}
+
+int main(int argc, char **argv) {
+    unsigned promSets = argc > 1 ? (unsigned)atoi(argv[1]) : 4;
+    uint32_t step = argc > 2 ? (uint32_t)atoi(argv[2]) : 65536;
+    unsigned seed = argc > 3 ? (unsigned)atoi(argv[3]) : 1;
+    unsigned threads = std::thread::hardware_concurrency();
+    if(threads == 0) {
+        threads = 1;
+    }
+    if(step == 0) {
+        step = 1;
+    }
+
+    srand(seed);
+    int failures = 0;
+    for(unsigned set = 0; set < promSets; set++) {
+        uint16_t coefficients[6] = { 40127, 36924, 23317, 23282, 33464, 28312 };
+        if(set > 0) {
+            for(int index = 0; index < 6; index++) {
+                coefficients[index] = (uint16_t)(1 + rand() % 65534);
+            }
+        }
+
+        std::vector<Result> results(threads);
+        std::vector<std::thread> workers;
+        uint32_t span = (1UL << 24) / threads + 1;
+        for(unsigned thread = 0; thread < threads; thread++) {
+            uint32_t first = thread * span;
+            uint32_t last = first + span > (1UL << 24) ? (1UL << 24) : first + span;
+            workers.push_back(std::thread(sweep, coefficients, first, last, step, std::ref(results[thread])));
+        }
+
+        Result total = { 0, 0, 0, 0, 0, 0.0 };
+        for(unsigned thread = 0; thread < threads; thread++) {
+            workers[thread].join();
+            Result &result = results[thread];
+            total.evaluations += result.evaluations;
+            total.pressureMismatches += result.pressureMismatches;
+            total.temperatureMismatches += result.temperatureMismatches;
+            if(result.maximumPressureError > total.maximumPressureError) {
+                total.maximumPressureError = result.maximumPressureError;
+            }
+            if(result.maximumTemperatureError > total.maximumTemperatureError) {
+                total.maximumTemperatureError = result.maximumTemperatureError;
+            }
+            if(result.maximumIdealError > total.maximumIdealError) {
+                total.maximumIdealError = result.maximumIdealError;
+            }
+        }
+
+        printf("PROM %u [%u %u %u %u %u %u]: %llu evaluations, pressure mismatches %llu (max %lld Pa), "
+               "temperature mismatches %llu (max %lld), max deviation from exact formula %.3f Pa\n",
+            set, coefficients[0], coefficients[1], coefficients[2], coefficients[3], coefficients[4], coefficients[5],
+            (unsigned long long)total.evaluations, (unsigned long long)total.pressureMismatches, (long long)total.maximumPressureError,
+            (unsigned long long)total.temperatureMismatches, (long long)total.maximumTemperatureError, total.maximumIdealError);
+        if(total.pressureMismatches > 0 || total.temperatureMismatches > 0) {
+            failures++;
+        }
+    }
+
+    return failures > 0 ? 1 : 0;
+}
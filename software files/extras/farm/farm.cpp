@@ -0,0 +1,155 @@
+/**
+ * Virtual sensor farm benchmark for MS5611Scheduler.
+ *
+ * Instantiates simulated MS5611 devices on virtual buses, two per bus at the two possible addresses,
+ * and drives one MS5611Scheduler per sensor from a single loop, as a gateway with one thread would. Bus
+ * transfers are timed at the configured I2C clock and, like blocking Wire calls, advance the one shared
+ * virtual clock, so the bus time of all sensors adds up and the farm saturates where it would on real
+ * hardware. For each sensor count it reports:
+ *
+ *   - host CPU time per update() call and per delivered sample (scheduler, driver and simulated bus),
+ *   - driver memory per sensor (sizeof MS5611 + MS5611Scheduler on this host; smaller on 8-bit targets),
+ *   - achieved aggregate sample rate against the requested rate, the conversion rate including the D2
+ *     conversions for compensation and the share of time spent on the bus.
+ *
+ * Build and run on the host:
+ *
+ *     g++ -O2 -std=c++11 -I../host -I../../src farm.cpp ../host/Arduino.cpp ../host/Wire.cpp \
+ *         ../host/MS5611Device.cpp ../../src/MS5611.cpp ../../src/MS5611Scheduler.cpp \
+ *         ../../src/MS5611Dispatcher.cpp -o farm
+ *     ./farm [rate Hz] [simulated seconds] [I2C clock Hz] [sensor counts...]
+ *
+ * The defaults are 10 Hz per sensor, 10 s, 400 kHz and 100 250 500 1000 2000 sensors.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <vector>
+
+#include "Arduino.h"
+#include "Wire.h"
+#include "MS5611Device.h"
+#include "MS5611.h"
+#include "MS5611Scheduler.h"
+
+#define FARM_LOOP_STEP 100
+
+struct Result {
+    uint32_t sensors;
+    uint64_t updates;
+    uint64_t samples;
+    uint64_t conversions;
+    uint64_t busTime;
+    double simulated;
+    double cpu;
+};
+
+static Result run(uint32_t sensorCount, uint32_t rate, double duration, uint32_t clockFrequency) {
+    uint32_t busCount = (sensorCount + 1) / 2;
+    std::vector<TwoWire *> buses;
+    std::vector<MS5611Device *> devices;
+    std::vector<MS5611 *> sensors;
+    std::vector<MS5611Scheduler *> schedulers;
+
+    HostClock::set(0);
+    for(uint32_t index = 0; index < busCount; index++) {
+        TwoWire *bus = new TwoWire();
+        bus->setClock(clockFrequency);
+        bus->setTransferTiming(true);
+        buses.push_back(bus);
+    }
+    for(uint32_t index = 0; index < sensorCount; index++) {
+        uint8_t address = index % 2 == 0 ? MS5611_ADDRESS : MS5611_ALTERNATE_ADDRESS;
+        MS5611Device *device = new MS5611Device();
+        device->setPressure(100000 + (int32_t)(index % 1000));
+        device->setNoise(4, index + 1);
+        buses[index / 2]->attach(address, *device);
+        devices.push_back(device);
+        sensors.push_back(new MS5611(address, *buses[index / 2]));
+    }
+
+    for(uint32_t index = 0; index < sensorCount; index++) {
+        sensors[index]->beginReset(ULTRA_HIGH_RES);
+    }
+    delay(MS5611_RESET_DELAY);
+    for(uint32_t index = 0; index < sensorCount; index++) {
+        sensors[index]->getCalibrationData();
+        schedulers.push_back(new MS5611Scheduler(*sensors[index]));
+        schedulers[index]->begin(1000000UL / rate, 0, 0);
+    }
+
+    Result result = { sensorCount, 0, 0, 0, 0, 0, 0 };
+    uint64_t conversionStart = 0;
+    for(uint32_t index = 0; index < sensorCount; index++) {
+        conversionStart += devices[index]->getConversionCount();
+    }
+    uint64_t start = HostClock::now();
+    uint64_t end = start + (uint64_t)(duration * 1e6);
+    uint64_t idle = 0;
+    clock_t cpuStart = clock();
+
+    while(HostClock::now() < end) {
+        for(uint32_t index = 0; index < sensorCount; index++) {
+            if(schedulers[index]->update() & MS5611_STREAM_PRESSURE) {
+                result.samples++;
+            }
+        }
+        result.updates += sensorCount;
+        HostClock::advance(FARM_LOOP_STEP);
+        idle += FARM_LOOP_STEP;
+    }
+
+    result.cpu = (double)(clock() - cpuStart) / CLOCKS_PER_SEC;
+    result.simulated = (HostClock::now() - start) / 1e6;
+    result.busTime = HostClock::now() - start - idle;
+    for(uint32_t index = 0; index < sensorCount; index++) {
+        result.conversions += devices[index]->getConversionCount();
+    }
+    result.conversions -= conversionStart;
+
+    for(uint32_t index = 0; index < sensorCount; index++) {
+        delete schedulers[index];
+        delete sensors[index];
+        delete devices[index];
+    }
+    for(uint32_t index = 0; index < busCount; index++) {
+        delete buses[index];
+    }
+    return result;
+}
+
+int main(int argc, char **argv) {
+    uint32_t rate = argc > 1 ? strtoul(argv[1], NULL, 10) : 10;
+    double duration = argc > 2 ? atof(argv[2]) : 10;
+    uint32_t clockFrequency = argc > 3 ? strtoul(argv[3], NULL, 10) : 400000;
+    std::vector<uint32_t> counts;
+    for(int index = 4; index < argc; index++) {
+        counts.push_back(strtoul(argv[index], NULL, 10));
+    }
+    if(counts.empty()) {
+        uint32_t defaults[] = { 100, 250, 500, 1000, 2000 };
+        counts.assign(defaults, defaults + 5);
+    }
+    if(rate == 0 || duration <= 0) {
+        fprintf(stderr, "usage: %s [rate Hz] [simulated seconds] [I2C clock Hz] [sensor counts...]\n", argv[0]);
+        return 1;
+    }
+
+    printf("%u Hz per sensor, %.1f s simulated, %u Hz I2C, %u bytes driver memory per sensor\n",
+        rate, duration, clockFrequency, (unsigned)(sizeof(MS5611) + sizeof(MS5611Scheduler)));
+    printf("%8s %8s %10s %10s %12s %12s %14s %6s\n", "sensors", "buses", "ns/update", "ns/sample",
+        "requested/s", "achieved/s", "conversions/s", "bus %");
+    for(size_t index = 0; index < counts.size(); index++) {
+        if(counts[index] == 0) {
+            continue;
+        }
+        Result result = run(counts[index], rate, duration, clockFrequency);
+        printf("%8u %8u %10.0f %10.0f %12u %12.0f %14.0f %6.1f\n", result.sensors, (result.sensors + 1) / 2,
+            result.updates > 0 ? result.cpu * 1e9 / result.updates : 0,
+            result.samples > 0 ? result.cpu * 1e9 / result.samples : 0,
+            result.sensors * rate, result.samples / result.simulated, result.conversions / result.simulated,
+            100.0 * result.busTime / (result.simulated * 1e6));
+    }
+    return 0;
+}
@@ -0,0 +1,149 @@
+#include "Arduino.h"
+#include <stdio.h>
+
+uint64_t HostClock::time = 0;
+
+/**
+ * @brief Retrieves the virtual time.
+ *
+ * @return Microseconds since the start of the simulation, without wrap-around.
+ */
+uint64_t HostClock::now(void) {
+    return time;
+}
+
+/**
+ * @brief Sets the virtual time, e.g. just below 2^32 µs to exercise micros() wrap-around.
+ *
+ * @param time Microseconds since the start of the simulation.
+ */
+void HostClock::set(uint64_t time) {
+    HostClock::time = time;
+}
+
+/**
+ * @brief Advances the virtual time.
+ *
+ * @param duration Microseconds to advance.
+ */
+void HostClock::advance(uint64_t duration) {
+    time += duration;
+}
+
+uint32_t millis(void) {
+    return (uint32_t)(HostClock::now() / 1000);
+}
+
+uint32_t micros(void) {
+    return (uint32_t)HostClock::now();
+}
+
+void delay(unsigned long duration) {
+    HostClock::advance((uint64_t)duration * 1000);
+}
+
+void delayMicroseconds(unsigned int duration) {
+    HostClock::advance(duration);
+}
+
+size_t Print::write(const uint8_t *buffer, size_t size) {
+    size_t written = 0;
+    while(size-- > 0) {
+        written += write(*buffer++);
+    }
+    return written;
+}
+
+size_t Print::print(const char *text) {
+    return write((const uint8_t *)text, strlen(text));
+}
+
+size_t Print::print(char value) {
+    return write((uint8_t)value);
+}
+
+size_t Print::print(int value, int base) {
+    return print((long)value, base);
+}
+
+size_t Print::print(unsigned int value, int base) {
+    return print((unsigned long)value, base);
+}
+
+size_t Print::print(long value, int base) {
+    if(base == 10 && value < 0) {
+        return print('-') + printNumber(0UL - (unsigned long)value, 10);
+    }
+    return printNumber((unsigned long)value, base);
+}
+
+size_t Print::print(unsigned long value, int base) {
+    return printNumber(value, base);
+}
+
+size_t Print::print(double value, int digits) {
+    char text[64];
+    snprintf(text, sizeof(text), "%.*f", digits, value);
+    return print(text);
+}
+
+size_t Print::println(void) {
+    return print("\r\n");
+}
+
+size_t Print::println(const char *text) {
+    return print(text) + println();
+}
+
+size_t Print::println(char value) {
+    return print(value) + println();
+}
+
+size_t Print::println(int value, int base) {
+    return print(value, base) + println();
+}
+
+size_t Print::println(unsigned int value, int base) {
+    return print(value, base) + println();
+}
+
+size_t Print::println(long value, int base) {
+    return print(value, base) + println();
+}
+
+size_t Print::println(unsigned long value, int base) {
+    return print(value, base) + println();
+}
+
+size_t Print::println(double value, int digits) {
+    return print(value, digits) + println();
+}
+
+size_t Print::printNumber(unsigned long value, int base) {
+    char text[8 * sizeof(unsigned long) + 1];
+    char *position = &text[sizeof(text) - 1];
+    *position = '\0';
+    if(base < 2) {
+        base = 10;
+    }
+    do {
+        unsigned long digit = value % base;
+        value /= base;
+        *--position = digit < 10 ? '0' + digit : 'A' + digit - 10;
+    } while(value > 0);
+    return print(position);
+}
+
+void HardwareSerial::begin(unsigned long baud) {
+    (void)baud;
+}
+
+size_t HardwareSerial::write(uint8_t value) {
+    return fputc(value, stdout) == EOF ? 0 : 1;
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size) {
+    return fwrite(buffer, 1, size, stdout);
+}
+
+HardwareSerial Serial;
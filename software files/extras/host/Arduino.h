@@ -0,0 +1,73 @@
+/**
+ * Host shim for the Arduino core with a virtual clock.
+ *
+ * Provides the subset of the Arduino API the library uses, so sketches and library code build and run
+ * on a desktop compiler. Time is simulated: delay() and delayMicroseconds() advance the clock instantly
+ * and millis()/micros() read it, so hours of sampling run in seconds and every run with the same inputs
+ * produces the same timestamps. millis() and micros() return 32-bit values that wrap like on the device,
+ * even on hosts where unsigned long has 64 bits. Serial prints to stdout.
+ *
+ * Build a program on the host together with the library and the simulated sensor, from the library root:
+ *
+ *     g++ -std=c++11 -Iextras/host -Isrc extras/host/Arduino.cpp extras/host/Wire.cpp \
+ *         extras/host/MS5611Device.cpp src/MS5611.cpp program.cpp
+ *
+ * The program provides main() and calls setup() and loop() itself. See demo/demo.cpp.
+ */
+
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+
+class HostClock {
+public:
+    static uint64_t now(void);
+    static void set(uint64_t time);
+    static void advance(uint64_t duration);
+private:
+    static uint64_t time;
+};
+
+uint32_t millis(void);
+uint32_t micros(void);
+void delay(unsigned long duration);
+void delayMicroseconds(unsigned int duration);
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t value) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size);
+    size_t print(const char *text);
+    size_t print(char value);
+    size_t print(int value, int base = 10);
+    size_t print(unsigned int value, int base = 10);
+    size_t print(long value, int base = 10);
+    size_t print(unsigned long value, int base = 10);
+    size_t print(double value, int digits = 2);
+    size_t println(void);
+    size_t println(const char *text);
+    size_t println(char value);
+    size_t println(int value, int base = 10);
+    size_t println(unsigned int value, int base = 10);
+    size_t println(long value, int base = 10);
+    size_t println(unsigned long value, int base = 10);
+    size_t println(double value, int digits = 2);
+private:
+    size_t printNumber(unsigned long value, int base);
+};
+
+class HardwareSerial : public Print {
+public:
+    void begin(unsigned long baud);
+    size_t write(uint8_t value);
+    size_t write(const uint8_t *buffer, size_t size);
+};
+
+extern HardwareSerial Serial;
+
+#endif
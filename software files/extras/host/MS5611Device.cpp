@@ -0,0 +1,180 @@
+#include "MS5611Device.h"
+#include "../../src/MS5611.h"
+
+static const uint16_t MS5611_DEVICE_DEFAULT_COEFFICIENTS[6] = { 40127, 36924, 23317, 23282, 33464, 28312 };
+static const uint16_t MS5611_DEVICE_CONVERSION_TIME[5] = { 600, 1170, 2280, 4540, 9040 };
+
+/**
+ * @brief Creates a sensor at 101325 Pa and 20 °C.
+ *
+ * @param coefficients C1 to C6 of the simulated part, or NULL for the datasheet example values.
+ */
+MS5611Device::MS5611Device(const uint16_t *coefficients) {
+    if(coefficients == NULL) {
+        coefficients = MS5611_DEVICE_DEFAULT_COEFFICIENTS;
+    }
+    prom[0] = 0x0000;
+    for(uint8_t index = 0; index < 6; index++) {
+        prom[index + 1] = coefficients[index];
+    }
+    prom[7] = 0x0000;
+    prom[7] |= MS5611Policy::getCrc(prom);
+
+    pressure = 101325;
+    temperature = 2000;
+    noise = 0;
+    seed = 1;
+    acknowledge = true;
+    command = 0;
+    converting = false;
+    conversionEnd = 0;
+    result = 0;
+    conversionCount = 0;
+}
+
+/**
+ * @brief Sets the simulated ambient pressure.
+ *
+ * @param pressure Pressure in Pa.
+ */
+void MS5611Device::setPressure(int32_t pressure) {
+    this->pressure = pressure;
+}
+
+/**
+ * @brief Sets the simulated die temperature.
+ *
+ * @param temperature Temperature in hundredths of a degree Celsius.
+ */
+void MS5611Device::setTemperature(int32_t temperature) {
+    this->temperature = temperature;
+}
+
+/**
+ * @brief Adds uniform noise to the raw values.
+ *
+ * @param amplitude Maximum deviation in ADC counts, 0 for none.
+ * @param seed Seed of the pseudo random sequence, so runs are reproducible.
+ */
+void MS5611Device::setNoise(uint16_t amplitude, uint32_t seed) {
+    noise = amplitude;
+    this->seed = seed != 0 ? seed : 1;
+}
+
+/**
+ * @brief Simulates a disconnected or failed sensor.
+ *
+ * @param acknowledge False makes the device NACK every transfer.
+ */
+void MS5611Device::setAcknowledge(bool acknowledge) {
+    this->acknowledge = acknowledge;
+}
+
+/**
+ * @brief Retrieves the number of conversions started.
+ *
+ * @return The conversion count.
+ */
+uint32_t MS5611Device::getConversionCount(void) {
+    return conversionCount;
+}
+
+/**
+ * @brief Calculates the noise-free D1 value for the current environment.
+ *
+ * @return The smallest raw pressure value that compensates (first order) to the set pressure.
+ */
+uint32_t MS5611Device::getRawPressure(void) {
+    int32_t dT = (int32_t)getRawTemperature() - (int32_t)prom[5] * 256;
+    int64_t offset = MS5611Compensation<MS5611Policy>::getOffset(prom + 1, dT, false);
+    int64_t sensitivity = MS5611Compensation<MS5611Policy>::getSensitivity(prom + 1, dT, false);
+    int64_t D1 = (((int64_t)pressure * 32768 + offset) * 2097152 + sensitivity - 1) / sensitivity;
+    return D1 < 0 ? 0 : D1 > 0xFFFFFF ? 0xFFFFFF : (uint32_t)D1;
+}
+
+/**
+ * @brief Calculates the noise-free D2 value for the current environment.
+ *
+ * @return The raw temperature value closest to the reference that compensates (first order) to the set
+ * temperature, accounting for the truncation of the compensation toward zero.
+ */
+uint32_t MS5611Device::getRawTemperature(void) {
+    int64_t difference = (int64_t)(temperature >= 2000 ? temperature - 2000 : 2000 - temperature) * 8388608;
+    int64_t dT = (difference + prom[6] - 1) / prom[6];
+    int64_t D2 = (int64_t)prom[5] * 256 + (temperature >= 2000 ? dT : -dT);
+    return D2 < 0 ? 0 : D2 > 0xFFFFFF ? 0xFFFFFF : (uint32_t)D2;
+}
+
+/**
+ * @brief Handles a command written by the driver.
+ *
+ * @param data Written bytes; only the first is a command.
+ * @param length Number of bytes.
+ * @return False if the device is set to NACK.
+ */
+bool MS5611Device::receive(const uint8_t *data, size_t length) {
+    if(!acknowledge) {
+        return false;
+    }
+    if(length == 0) {
+        return true;
+    }
+
+    command = data[0];
+    if(command == MS5611_RESET) {
+        converting = false;
+        result = 0;
+    } else if((command & 0xF0) == MS5611_CONV_D1 || (command & 0xF0) == MS5611_CONV_D2) {
+        uint8_t rate = (command & 0x0F) / 2;
+        converting = true;
+        conversionEnd = HostClock::now() + MS5611_DEVICE_CONVERSION_TIME[rate > 4 ? 4 : rate];
+        result = addNoise((command & 0xF0) == MS5611_CONV_D1 ? getRawPressure() : getRawTemperature());
+        conversionCount++;
+    }
+    return true;
+}
+
+/**
+ * @brief Answers a read transfer for the last command.
+ *
+ * @param data Receives the answer.
+ * @param length Number of requested bytes.
+ * @return The number of bytes answered, 0 if the device is set to NACK.
+ */
+size_t MS5611Device::request(uint8_t *data, size_t length) {
+    if(!acknowledge) {
+        return 0;
+    }
+
+    uint32_t value = 0;
+    if(command == MS5611_ADC_READ) {
+        if(converting && HostClock::now() >= conversionEnd) {
+            value = result;
+        }
+        converting = false;
+    } else if(command >= MS5611_PROM_BASE && command <= MS5611_PROM_BASE + 14) {
+        value = prom[(command - MS5611_PROM_BASE) / 2];
+    }
+
+    for(size_t index = 0; index < length; index++) {
+        data[index] = (uint8_t)(value >> (8 * (length - 1 - index)));
+    }
+    return length;
+}
+
+/**
+ * @brief Applies uniform noise to a raw value.
+ *
+ * @param value Raw value.
+ * @return The value with noise, limited to 24 bits.
+ */
+uint32_t MS5611Device::addNoise(uint32_t value) {
+    if(noise == 0) {
+        return value;
+    }
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    int64_t noisy = (int64_t)value + (int64_t)(seed % (2 * (uint32_t)noise + 1)) - noise;
+    return noisy < 0 ? 0 : noisy > 0xFFFFFF ? 0xFFFFFF : (uint32_t)noisy;
+}
@@ -0,0 +1,43 @@
+#ifndef MS5611Device_h
+#define MS5611Device_h
+
+#include "Arduino.h"
+#include "Wire.h"
+
+/**
+ * Simulated MS5611 for the host shim.
+ *
+ * Answers the reset, conversion, ADC read and PROM read commands like the sensor. Raw values are derived
+ * from the set pressure and temperature by inverting the first order compensation for the device's PROM,
+ * optionally with deterministic noise. A conversion takes the datasheet maximum time for its oversampling
+ * rate in virtual time; reading the ADC earlier, or twice, returns 0 as on the real part.
+ */
+class MS5611Device : public TwoWireDevice {
+public:
+    MS5611Device(const uint16_t *coefficients = NULL);
+    void setPressure(int32_t pressure);
+    void setTemperature(int32_t temperature);
+    void setNoise(uint16_t amplitude, uint32_t seed = 1);
+    void setAcknowledge(bool acknowledge);
+    uint32_t getConversionCount(void);
+    uint32_t getRawPressure(void);
+    uint32_t getRawTemperature(void);
+    bool receive(const uint8_t *data, size_t length);
+    size_t request(uint8_t *data, size_t length);
+private:
+    uint16_t prom[8];
+    int32_t pressure;
+    int32_t temperature;
+    uint16_t noise;
+    uint32_t seed;
+    bool acknowledge;
+    uint8_t command;
+    bool converting;
+    uint64_t conversionEnd;
+    uint32_t result;
+    uint32_t conversionCount;
+
+    uint32_t addNoise(uint32_t value);
+};
+
+#endif
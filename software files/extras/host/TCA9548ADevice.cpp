@@ -0,0 +1,85 @@
+#include "TCA9548ADevice.h"
+
+TCA9548ADevice::TCA9548ADevice() {
+    for(uint8_t channel = 0; channel < TCA9548A_DEVICE_CHANNELS; channel++) {
+        for(uint8_t address = 0; address < 128; address++) {
+            devices[channel][address] = NULL;
+        }
+    }
+    for(uint8_t address = 0; address < 128; address++) {
+        ports[address].mux = this;
+        ports[address].address = address;
+    }
+    mask = 0;
+}
+
+/**
+ * @brief Connects a simulated device behind one channel.
+ *
+ * @param channel Channel 0 to 7.
+ * @param address 7-bit address of the device on that channel.
+ * @param device Device to connect. It must outlive the multiplexer.
+ */
+void TCA9548ADevice::attachChannel(uint8_t channel, uint8_t address, TwoWireDevice &device) {
+    if(channel < TCA9548A_DEVICE_CHANNELS) {
+        devices[channel][address & 0x7F] = &device;
+    }
+}
+
+/**
+ * @brief Retrieves the upstream port for a downstream address.
+ *
+ * @param address 7-bit downstream address.
+ * @return The device to attach to the upstream bus at that address.
+ */
+TwoWireDevice &TCA9548ADevice::getPort(uint8_t address) {
+    return ports[address & 0x7F];
+}
+
+/**
+ * @brief Retrieves the channel enable mask.
+ *
+ * @return One bit per enabled channel.
+ */
+uint8_t TCA9548ADevice::getMask(void) {
+    return mask;
+}
+
+bool TCA9548ADevice::receive(const uint8_t *data, size_t length) {
+    if(length > 0) {
+        mask = data[length - 1];
+    }
+    return true;
+}
+
+size_t TCA9548ADevice::request(uint8_t *data, size_t length) {
+    for(size_t index = 0; index < length; index++) {
+        data[index] = mask;
+    }
+    return length;
+}
+
+/**
+ * @brief Finds the device answering at an address on the enabled channels.
+ *
+ * @param address 7-bit downstream address.
+ * @return The device on the lowest enabled channel, or NULL.
+ */
+TwoWireDevice *TCA9548ADevice::route(uint8_t address) {
+    for(uint8_t channel = 0; channel < TCA9548A_DEVICE_CHANNELS; channel++) {
+        if((mask & (1 << channel)) != 0 && devices[channel][address] != NULL) {
+            return devices[channel][address];
+        }
+    }
+    return NULL;
+}
+
+bool TCA9548ADevice::Port::receive(const uint8_t *data, size_t length) {
+    TwoWireDevice *device = mux->route(address);
+    return device != NULL && device->receive(data, length);
+}
+
+size_t TCA9548ADevice::Port::request(uint8_t *data, size_t length) {
+    TwoWireDevice *device = mux->route(address);
+    return device != NULL ? device->request(data, length) : 0;
+}
@@ -0,0 +1,41 @@
+#ifndef TCA9548ADevice_h
+#define TCA9548ADevice_h
+
+#include "Arduino.h"
+#include "Wire.h"
+
+#define TCA9548A_DEVICE_CHANNELS 8
+
+/**
+ * Simulated TCA9548A I2C multiplexer for the host shim.
+ *
+ * Attach the multiplexer itself at its address and, for every downstream address, the port returned by
+ * `getPort`. A port forwards transfers to the device at that address on the lowest enabled channel and
+ * NACKs when no enabled channel has one, like the real switch.
+ */
+class TCA9548ADevice : public TwoWireDevice {
+public:
+    TCA9548ADevice();
+    void attachChannel(uint8_t channel, uint8_t address, TwoWireDevice &device);
+    TwoWireDevice &getPort(uint8_t address);
+    uint8_t getMask(void);
+    bool receive(const uint8_t *data, size_t length);
+    size_t request(uint8_t *data, size_t length);
+private:
+    class Port : public TwoWireDevice {
+    public:
+        TCA9548ADevice *mux;
+        uint8_t address;
+
+        bool receive(const uint8_t *data, size_t length);
+        size_t request(uint8_t *data, size_t length);
+    };
+
+    TwoWireDevice *devices[TCA9548A_DEVICE_CHANNELS][128];
+    Port ports[128];
+    uint8_t mask;
+
+    TwoWireDevice *route(uint8_t address);
+};
+
+#endif
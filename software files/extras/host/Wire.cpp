@@ -0,0 +1,134 @@
+#include "Wire.h"
+
+TwoWire::TwoWire() {
+    for(uint8_t index = 0; index < 128; index++) {
+        devices[index] = NULL;
+    }
+    bufferLength = 0;
+    bufferIndex = 0;
+    address = 0;
+    frequency = 100000;
+    transferTiming = false;
+    transferCount = 0;
+}
+
+void TwoWire::begin(void) {
+}
+
+void TwoWire::setClock(uint32_t frequency) {
+    this->frequency = frequency > 0 ? frequency : 100000;
+}
+
+/**
+ * @brief Enables advancing the virtual clock by the wire time of each transfer.
+ *
+ * @param enabled False, the default, makes transfers take no simulated time.
+ */
+void TwoWire::setTransferTiming(bool enabled) {
+    transferTiming = enabled;
+}
+
+/**
+ * @brief Connects a simulated device.
+ *
+ * @param address 7-bit bus address.
+ * @param device Device answering at that address. It must outlive its attachment.
+ */
+void TwoWire::attach(uint8_t address, TwoWireDevice &device) {
+    devices[address & 0x7F] = &device;
+}
+
+void TwoWire::detach(uint8_t address) {
+    devices[address & 0x7F] = NULL;
+}
+
+void TwoWire::beginTransmission(uint8_t address) {
+    this->address = address & 0x7F;
+    bufferLength = 0;
+    bufferIndex = 0;
+}
+
+size_t TwoWire::write(uint8_t value) {
+    if(bufferLength >= HOST_WIRE_BUFFER_SIZE) {
+        return 0;
+    }
+    buffer[bufferLength++] = value;
+    return 1;
+}
+
+/**
+ * @brief Delivers the buffered bytes to the addressed device.
+ *
+ * @param stop Ignored; repeated starts behave like a stop followed by a start.
+ * @return 0 on success, 2 if no device acknowledged the address and 3 if the device rejected the data,
+ * matching the Arduino return codes.
+ */
+uint8_t TwoWire::endTransmission(bool stop) {
+    (void)stop;
+    uint8_t length = bufferLength;
+    bufferLength = 0;
+    transfer(length);
+    if(devices[address] == NULL) {
+        return 2;
+    }
+    return devices[address]->receive(buffer, length) ? 0 : 3;
+}
+
+/**
+ * @brief Reads bytes from a device into the receive buffer.
+ *
+ * @param address 7-bit bus address.
+ * @param quantity Number of bytes to read.
+ * @return The number of bytes the device answered, 0 if no device is attached.
+ */
+uint8_t TwoWire::requestFrom(uint8_t address, uint8_t quantity) {
+    address &= 0x7F;
+    if(quantity > HOST_WIRE_BUFFER_SIZE) {
+        quantity = HOST_WIRE_BUFFER_SIZE;
+    }
+    bufferIndex = 0;
+    bufferLength = 0;
+    transfer(quantity);
+    if(devices[address] != NULL) {
+        bufferLength = (uint8_t)devices[address]->request(buffer, quantity);
+    }
+    return bufferLength;
+}
+
+uint8_t TwoWire::requestFrom(int address, int quantity) {
+    return requestFrom((uint8_t)address, (uint8_t)quantity);
+}
+
+int TwoWire::read(void) {
+    if(bufferIndex >= bufferLength) {
+        return -1;
+    }
+    return buffer[bufferIndex++];
+}
+
+int TwoWire::available(void) {
+    return bufferLength - bufferIndex;
+}
+
+/**
+ * @brief Retrieves the number of transfers since construction.
+ *
+ * @return The count of write and read transfers.
+ */
+uint32_t TwoWire::getTransferCount(void) {
+    return transferCount;
+}
+
+/**
+ * @brief Accounts for one transfer.
+ *
+ * @param length Number of data bytes.
+ */
+void TwoWire::transfer(uint8_t length) {
+    transferCount++;
+    if(transferTiming) {
+        HostClock::advance(((uint64_t)(length + 1) * 9 + 2) * 1000000 / frequency);
+    }
+}
+
+TwoWire Wire;
@@ -0,0 +1,56 @@
+#ifndef TwoWire_h
+#define TwoWire_h
+
+#include "Arduino.h"
+
+#define HOST_WIRE_BUFFER_SIZE 32
+
+/**
+ * A device on a simulated bus. `receive` gets the bytes of each write transfer and returns false to NACK
+ * it; `request` fills the buffer for a read transfer and returns the number of bytes it answered.
+ */
+class TwoWireDevice {
+public:
+    virtual ~TwoWireDevice() {}
+    virtual bool receive(const uint8_t *data, size_t length) = 0;
+    virtual size_t request(uint8_t *data, size_t length) = 0;
+};
+
+/**
+ * Simulated I2C bus. Devices are attached by address; transfers to a free address are NACKed. With
+ * `setTransferTiming` enabled every transfer advances the virtual clock by its duration on the wire at
+ * the configured clock (9 bit times per byte including the address, plus start and stop), so bus load
+ * shows up in simulated time.
+ */
+class TwoWire {
+public:
+    TwoWire();
+    void begin(void);
+    void setClock(uint32_t frequency);
+    void setTransferTiming(bool enabled);
+    void attach(uint8_t address, TwoWireDevice &device);
+    void detach(uint8_t address);
+    void beginTransmission(uint8_t address);
+    size_t write(uint8_t value);
+    uint8_t endTransmission(bool stop = true);
+    uint8_t requestFrom(uint8_t address, uint8_t quantity);
+    uint8_t requestFrom(int address, int quantity);
+    int read(void);
+    int available(void);
+    uint32_t getTransferCount(void);
+private:
+    TwoWireDevice *devices[128];
+    uint8_t buffer[HOST_WIRE_BUFFER_SIZE];
+    uint8_t bufferLength;
+    uint8_t bufferIndex;
+    uint8_t address;
+    uint32_t frequency;
+    bool transferTiming;
+    uint32_t transferCount;
+
+    void transfer(uint8_t length);
+};
+
+extern TwoWire Wire;
+
+#endif
@@ -0,0 +1,87 @@
+/**
+ * Virtual clock demo: one simulated hour of 100 Hz scheduled sampling.
+ *
+ * Runs MS5611Scheduler against a simulated noisy sensor whose pressure follows a slow oscillation,
+ * starting just before the 32-bit micros() wrap. The run is made twice and the digests of all outputs
+ * are compared, which shows that simulated timing is deterministic. The wall clock time of a run and the
+ * largest deviation of the output from the simulated pressure are reported.
+ *
+ *     cd extras/host/demo
+ *     g++ -O2 -std=c++11 -I.. -I../../../src demo.cpp ../Arduino.cpp ../Wire.cpp ../MS5611Device.cpp \
+ *         ../../../src/MS5611.cpp ../../../src/MS5611Scheduler.cpp ../../../src/MS5611Dispatcher.cpp -o demo
+ *     ./demo
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "Arduino.h"
+#include "Wire.h"
+#include "MS5611Device.h"
+#include "MS5611.h"
+#include "MS5611Scheduler.h"
+
+#define DEMO_DURATION 3600000000ULL
+#define DEMO_PERIOD 10000UL
+#define DEMO_STEP 250
+
+struct Run {
+    uint32_t samples;
+    uint32_t conversions;
+    uint64_t digest;
+    int32_t maximumError;
+    double wall;
+};
+
+static int32_t getPressure(uint64_t elapsed) {
+    return 101325 + (int32_t)(200 * sin(elapsed * 2 * M_PI / 600e6));
+}
+
+static Run run(void) {
+    Run result = { 0, 0, 14695981039346656037ULL, 0, 0 };
+    MS5611Device device;
+    device.setNoise(4, 12345);
+    Wire.attach(MS5611_ADDRESS, device);
+
+    HostClock::set(0x100000000ULL - 30000000ULL);
+    uint64_t start = HostClock::now();
+    clock_t wallStart = clock();
+
+    MS5611 sensor;
+    sensor.begin(ULTRA_HIGH_RES);
+    MS5611Scheduler scheduler(sensor);
+    scheduler.begin(DEMO_PERIOD, 0, 0);
+
+    while(HostClock::now() - start < DEMO_DURATION) {
+        device.setPressure(getPressure(HostClock::now() - start));
+
+        if(scheduler.update() & MS5611_STREAM_PRESSURE) {
+            const MS5611Sample &sample = scheduler.getSample();
+            int32_t error = abs(sample.pressure - getPressure(HostClock::now() - start));
+            if(error > result.maximumError) {
+                result.maximumError = error;
+            }
+            result.digest = (result.digest ^ sample.timestamp) * 1099511628211ULL;
+            result.digest = (result.digest ^ (uint32_t)sample.pressure) * 1099511628211ULL;
+            result.samples++;
+        }
+        HostClock::advance(DEMO_STEP);
+    }
+
+    result.wall = (double)(clock() - wallStart) / CLOCKS_PER_SEC;
+    result.conversions = device.getConversionCount();
+    Wire.detach(MS5611_ADDRESS);
+    return result;
+}
+
+int main(void) {
+    Run first = run();
+    Run second = run();
+
+    printf("simulated %.0f s in %.2f s wall time\n", DEMO_DURATION / 1e6, first.wall);
+    printf("samples %u, conversions %u, maximum error %d Pa\n", first.samples, first.conversions, first.maximumError);
+    printf("digests %016llx %016llx: %s\n", (unsigned long long)first.digest, (unsigned long long)second.digest,
+        first.digest == second.digest ? "identical" : "different");
+    return first.digest == second.digest ? 0 : 1;
+}
@@ -0,0 +1,116 @@
+#ifndef FlightProfile_h
+#define FlightProfile_h
+
+/**
+ * Scripted rocket flight for the host tests, in centimetres and seconds above the launch site.
+ *
+ * The vehicle rests on the pad for 1 s, boosts at 50 m/s² for 2 s, coasts through apogee until it
+ * falls at 8 m/s, and then descends under the parachute at that speed to the ground, where it stays.
+ * Optionally it hovers at a given altitude on the way down, as a multicopter or a parachute caught in a
+ * tree would. `getAcceleration` is what an ideal accelerometer with gravity removed reads; the parachute
+ * opening, the hover and the touchdown are velocity steps.
+ */
+class FlightProfile {
+public:
+    FlightProfile(double hoverAltitude = 0, double hoverDuration = 0) {
+        this->hoverAltitude = hoverAltitude;
+        this->hoverDuration = hoverDuration;
+        stage = PAD;
+        time = 0;
+        altitude = 0;
+        speed = 0;
+        acceleration = 0;
+        hovered = 0;
+        peak = 0;
+        peakTime = 0;
+        touchdown = 0;
+    }
+
+    void step(double dt) {
+        time += dt;
+        switch(stage) {
+        case PAD:
+            if(time >= 1) {
+                stage = BOOST;
+            }
+            break;
+        case BOOST:
+            acceleration = 5000;
+            if(time >= 3) {
+                stage = COAST;
+            }
+            break;
+        case COAST:
+            acceleration = -981;
+            if(speed <= -800) {
+                stage = CHUTE;
+            }
+            break;
+        case CHUTE:
+            acceleration = 0;
+            speed = -800;
+            if(hovered == 0 && hoverDuration > 0 && altitude <= hoverAltitude) {
+                stage = HOVER;
+            }
+            break;
+        case HOVER:
+            speed = 0;
+            hovered += dt;
+            if(hovered >= hoverDuration) {
+                stage = CHUTE;
+                speed = -800;
+            }
+            break;
+        case LANDED:
+            break;
+        }
+        if(stage == BOOST || stage == COAST) {
+            speed += acceleration * dt;
+        }
+        altitude += speed * dt;
+        if(altitude > peak) {
+            peak = altitude;
+            peakTime = time;
+        }
+        if(stage == CHUTE && altitude <= 0) {
+            stage = LANDED;
+            altitude = 0;
+            speed = 0;
+            touchdown = time;
+        }
+    }
+
+    double getTime(void) { return time; }
+    double getAltitude(void) { return altitude; }
+    double getSpeed(void) { return speed; }
+    double getAcceleration(void) { return stage == BOOST || stage == COAST ? acceleration : 0; }
+    double getPeak(void) { return peak; }
+    double getPeakTime(void) { return peakTime; }
+    double getTouchdown(void) { return touchdown; }
+    bool isHovering(void) { return stage == HOVER; }
+    bool isLanded(void) { return stage == LANDED; }
+
+private:
+    enum Stage {
+        PAD,
+        BOOST,
+        COAST,
+        CHUTE,
+        HOVER,
+        LANDED
+    };
+
+    Stage stage;
+    double hoverAltitude;
+    double hoverDuration;
+    double time;
+    double altitude;
+    double speed;
+    double acceleration;
+    double hovered;
+    double peak;
+    double peakTime;
+    double touchdown;
+};
+
+#endif
@@ -0,0 +1,27 @@
+#ifndef HostTest_h
+#define HostTest_h
+
+#include <stdio.h>
+
+/**
+ * Minimal check helpers for the host tests. Each test is a program whose main() returns hostResult().
+ */
+static int hostChecks = 0;
+static int hostFailures = 0;
+
+#define HOST_CHECK(condition) hostCheck((condition), #condition, __FILE__, __LINE__)
+
+static inline void hostCheck(bool condition, const char *text, const char *file, int line) {
+    hostChecks++;
+    if(!condition) {
+        hostFailures++;
+        printf("%s:%d: check failed: %s\n", file, line, text);
+    }
+}
+
+static inline int hostResult(void) {
+    printf("%d checks, %d failed\n", hostChecks, hostFailures);
+    return hostFailures == 0 ? 0 : 1;
+}
+
+#endif
@@ -0,0 +1,141 @@
+/**
+ * A sensor that stops acknowledging must read as 0 and be treated as missing, not as a 0xFFFFFF reading.
+ */
+
+#include "HostTest.h"
+#include "Arduino.h"
+#include "Wire.h"
+#include "MS5611Device.h"
+#include "MS5611.h"
+#include "MS5611Group.h"
+#include "MS5611Differential.h"
+#include "MS5611Burst.h"
+#include "MS5611Scheduler.h"
+
+static void testDriver(void) {
+    TwoWire bus;
+    MS5611Device device;
+    bus.attach(MS5611_ADDRESS, device);
+    MS5611 sensor(MS5611_ADDRESS, bus);
+    HOST_CHECK(sensor.begin(ULTRA_HIGH_RES));
+    HOST_CHECK(sensor.readRawPressure() != 0);
+
+    device.setAcknowledge(false);
+    sensor.resetStatistics();
+    HOST_CHECK(sensor.readRawPressure() == 0);
+    HOST_CHECK(sensor.readRawTemperature() == 0);
+    HOST_CHECK(sensor.getStatistics().busErrors > 0);
+    HOST_CHECK(sensor.getStatistics().incompleteConversions == 0);
+
+    bus.detach(MS5611_ADDRESS);
+    HOST_CHECK(sensor.readRawPressure() == 0);
+}
+
+static void testGroup(void) {
+    TwoWire buses[3];
+    MS5611Device devices[3];
+    MS5611 *sensors[3];
+    MS5611Group group;
+    for(uint8_t index = 0; index < 3; index++) {
+        devices[index].setPressure(100000);
+        buses[index].attach(MS5611_ADDRESS, devices[index]);
+        sensors[index] = new MS5611(MS5611_ADDRESS, buses[index]);
+        group.add(*sensors[index]);
+    }
+    HOST_CHECK(group.begin(ULTRA_HIGH_RES));
+
+    devices[1].setAcknowledge(false);
+    devices[2].setAcknowledge(false);
+    for(uint8_t cycle = 0; cycle < 10; cycle++) {
+        int32_t pressure = 0;
+        HOST_CHECK(group.read(pressure));
+        HOST_CHECK(pressure == 100000);
+    }
+    HOST_CHECK(group.isHealthy(0));
+    HOST_CHECK(!group.isHealthy(1));
+    HOST_CHECK(!group.isHealthy(2));
+
+    devices[0].setAcknowledge(false);
+    int32_t pressure = 0;
+    HOST_CHECK(!group.read(pressure));
+
+    for(uint8_t index = 0; index < 3; index++) {
+        delete sensors[index];
+    }
+}
+
+static void testDifferential(void) {
+    TwoWire bus;
+    MS5611Device first;
+    MS5611Device second;
+    first.setPressure(100100);
+    second.setPressure(100000);
+    bus.attach(MS5611_ADDRESS, first);
+    bus.attach(MS5611_ALTERNATE_ADDRESS, second);
+    MS5611 firstSensor(MS5611_ADDRESS, bus);
+    MS5611 secondSensor(MS5611_ALTERNATE_ADDRESS, bus);
+    firstSensor.begin(ULTRA_HIGH_RES);
+    secondSensor.begin(ULTRA_HIGH_RES);
+    MS5611Differential differential(firstSensor, secondSensor);
+
+    int32_t difference = 0;
+    HOST_CHECK(differential.read(difference));
+    HOST_CHECK(difference == 100);
+
+    second.setAcknowledge(false);
+    HOST_CHECK(!differential.read(difference));
+}
+
+static void testBurst(void) {
+    TwoWire bus;
+    MS5611Device device;
+    bus.attach(MS5611_ADDRESS, device);
+    MS5611 sensor(MS5611_ADDRESS, bus);
+    MS5611Burst burst(sensor);
+    MS5611Checkpoint checkpoint;
+    memset(&checkpoint, 0, sizeof(checkpoint));
+    HOST_CHECK(burst.wake(checkpoint, ULTRA_HIGH_RES));
+
+    MS5611Sample sample;
+    HOST_CHECK(burst.sample(sample, 1));
+    device.setAcknowledge(false);
+    HOST_CHECK(!burst.sample(sample, 2));
+}
+
+static void testScheduler(void) {
+    TwoWire bus;
+    MS5611Device device;
+    bus.attach(MS5611_ADDRESS, device);
+    MS5611 sensor(MS5611_ADDRESS, bus);
+    sensor.begin(ULTRA_HIGH_RES);
+    MS5611Scheduler scheduler(sensor);
+    scheduler.begin(20000, 0, 0);
+
+    uint32_t samples = 0;
+    for(uint16_t step = 0; step < 2000; step++) {
+        if(scheduler.update() & MS5611_STREAM_PRESSURE) {
+            samples++;
+        }
+        delayMicroseconds(500);
+    }
+    HOST_CHECK(samples > 0);
+
+    device.setAcknowledge(false);
+    samples = 0;
+    for(uint16_t step = 0; step < 2000; step++) {
+        if(scheduler.update() & MS5611_STREAM_PRESSURE) {
+            samples++;
+        }
+        delayMicroseconds(500);
+    }
+    HOST_CHECK(samples == 0);
+}
+
+int main(void) {
+    testDriver();
+    testGroup();
+    testDifferential();
+    testBurst();
+    testScheduler();
+    return hostResult();
+}
@@ -0,0 +1,97 @@
+/**
+ * MS5611FlightEvents driven by MS5611Fusion along scripted flights: a normal flight fires launch, apogee
+ * and landing once each, and a hover high above the launch site is not reported as a landing.
+ */
+
+#include "HostTest.h"
+#include "Arduino.h"
+#include "MS5611Fusion.h"
+#include "MS5611FlightEvents.h"
+#include "FlightProfile.h"
+
+struct Events {
+    uint8_t count[3];
+    int32_t altitude[3];
+    uint32_t timestamp[3];
+};
+
+static void onEvent(MS5611_event event, int32_t altitude, uint32_t timestamp, void *context) {
+    Events *events = (Events *)context;
+    events->count[event]++;
+    events->altitude[event] = altitude;
+    events->timestamp[event] = timestamp;
+}
+
+static void fly(FlightProfile &profile, MS5611FlightEvents &detector, Events &events, double duration, bool &landedWhileHovering) {
+    memset(&events, 0, sizeof(events));
+    detector.setCallback(&onEvent, &events);
+    detector.begin(0);
+    MS5611Fusion fusion;
+    fusion.begin(0);
+    landedWhileHovering = false;
+    uint32_t state = 1;
+    for(uint32_t step = 0; step < duration * 100; step++) {
+        profile.step(0.01);
+        state = state * 1664525UL + 1013904223UL;
+        int32_t noise = (int32_t)((state >> 16) % 61) - 30;
+        fusion.update((int32_t)profile.getAltitude() + noise, (int32_t)profile.getAcceleration(), 10000);
+        detector.update(fusion, (uint32_t)(profile.getTime() * 1000 + 0.5));
+        if(profile.isHovering() && detector.isLanded()) {
+            landedWhileHovering = true;
+        }
+    }
+}
+
+static void testFlight(void) {
+    FlightProfile profile;
+    MS5611FlightEvents detector;
+    Events events;
+    bool landedWhileHovering;
+    fly(profile, detector, events, 120, landedWhileHovering);
+
+    HOST_CHECK(events.count[LAUNCH_EVENT] == 1);
+    HOST_CHECK(events.count[APOGEE_EVENT] == 1);
+    HOST_CHECK(events.count[LANDING_EVENT] == 1);
+    HOST_CHECK(events.timestamp[LAUNCH_EVENT] > 1000 && events.timestamp[LAUNCH_EVENT] < 2000);
+    HOST_CHECK(events.altitude[APOGEE_EVENT] > profile.getPeak() - 100 && events.altitude[APOGEE_EVENT] < profile.getPeak() + 100);
+    HOST_CHECK(events.timestamp[APOGEE_EVENT] > profile.getPeakTime() * 1000 - 300);
+    HOST_CHECK(events.timestamp[APOGEE_EVENT] < profile.getPeakTime() * 1000 + 300);
+    HOST_CHECK(profile.isLanded());
+    HOST_CHECK(events.timestamp[LANDING_EVENT] >= profile.getTouchdown() * 1000 - 500);
+    HOST_CHECK(events.timestamp[LANDING_EVENT] < profile.getTouchdown() * 1000 + 10000);
+    HOST_CHECK(detector.isLanded());
+}
+
+static void testHover(void) {
+    FlightProfile profile(5000, 30);
+    MS5611FlightEvents detector;
+    Events events;
+    bool landedWhileHovering;
+    fly(profile, detector, events, 150, landedWhileHovering);
+
+    HOST_CHECK(!landedWhileHovering);
+    HOST_CHECK(profile.isLanded());
+    HOST_CHECK(events.count[LANDING_EVENT] == 1);
+    HOST_CHECK(events.timestamp[LANDING_EVENT] >= profile.getTouchdown() * 1000 - 500);
+    HOST_CHECK(events.altitude[LANDING_EVENT] > -MS5611_EVENTS_LANDING_ALTITUDE);
+    HOST_CHECK(events.altitude[LANDING_EVENT] < MS5611_EVENTS_LANDING_ALTITUDE);
+}
+
+static void testHoverWithoutAltitudeLimit(void) {
+    FlightProfile profile(5000, 30);
+    MS5611FlightEvents detector;
+    detector.setLanding(MS5611_EVENTS_LANDING_SPEED, MS5611_EVENTS_LANDING_DURATION, 1000000);
+    Events events;
+    bool landedWhileHovering;
+    fly(profile, detector, events, 150, landedWhileHovering);
+
+    HOST_CHECK(landedWhileHovering);
+    HOST_CHECK(events.altitude[LANDING_EVENT] > 4000);
+}
+
+int main(void) {
+    testFlight();
+    testHover();
+    testHoverWithoutAltitudeLimit();
+    return hostResult();
+}
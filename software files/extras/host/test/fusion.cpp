@@ -0,0 +1,79 @@
+/**
+ * MS5611Fusion follows a scripted flight from a noisy barometer and a biased accelerometer: it learns the
+ * bias on the pad, smooths the barometer noise and tracks altitude and vertical speed without lag.
+ */
+
+#include "HostTest.h"
+#include "Arduino.h"
+#include "MS5611Fusion.h"
+#include "FlightProfile.h"
+
+#define BARO_NOISE 30
+#define ACCELERATION_BIAS 20
+
+static uint32_t state = 1;
+
+static int32_t noise(void) {
+    state = state * 1664525UL + 1013904223UL;
+    return (int32_t)((state >> 16) % (2 * BARO_NOISE + 1)) - BARO_NOISE;
+}
+
+static void testPad(void) {
+    MS5611Fusion fusion;
+    fusion.begin(0);
+    int32_t maximumAltitude = 0;
+    int32_t maximumSpeed = 0;
+    for(uint32_t step = 0; step < 6000; step++) {
+        fusion.update(noise(), ACCELERATION_BIAS, 10000);
+        if(step >= 3000) {
+            int32_t altitude = fusion.getAltitude() < 0 ? -fusion.getAltitude() : fusion.getAltitude();
+            int32_t speed = fusion.getVerticalSpeed() < 0 ? -fusion.getVerticalSpeed() : fusion.getVerticalSpeed();
+            maximumAltitude = altitude > maximumAltitude ? altitude : maximumAltitude;
+            maximumSpeed = speed > maximumSpeed ? speed : maximumSpeed;
+        }
+    }
+    HOST_CHECK(maximumAltitude <= BARO_NOISE / 2);
+    HOST_CHECK(maximumSpeed <= BARO_NOISE / 2);
+}
+
+static void testFlight(void) {
+    FlightProfile profile;
+    MS5611Fusion fusion;
+    fusion.begin(0);
+    for(uint32_t step = 0; step < 3000; step++) {
+        fusion.update(noise(), ACCELERATION_BIAS, 10000);
+    }
+    double altitudeError = 0;
+    double speedError = 0;
+    int32_t peak = 0;
+    double peakTime = 0;
+    while(!profile.isLanded()) {
+        profile.step(0.01);
+        fusion.update((int32_t)profile.getAltitude() + noise(), (int32_t)profile.getAcceleration() + ACCELERATION_BIAS, 10000);
+        if(fusion.getAltitude() > peak) {
+            peak = fusion.getAltitude();
+            peakTime = profile.getTime();
+        }
+        if(profile.getTime() < 1 || profile.getAcceleration() != 0) {
+            altitudeError = fmax(altitudeError, fabs(fusion.getAltitude() - profile.getAltitude()));
+            speedError = fmax(speedError, fabs(fusion.getVerticalSpeed() - profile.getSpeed()));
+        }
+    }
+    HOST_CHECK(altitudeError < 20);
+    HOST_CHECK(speedError < 20);
+    HOST_CHECK(fabs(peak - profile.getPeak()) < 10);
+    HOST_CHECK(fabs(peakTime - profile.getPeakTime()) < 0.05);
+
+    for(uint32_t step = 0; step < 2000; step++) {
+        profile.step(0.01);
+        fusion.update((int32_t)profile.getAltitude() + noise(), (int32_t)profile.getAcceleration() + ACCELERATION_BIAS, 10000);
+    }
+    HOST_CHECK(fusion.getAltitude() >= -BARO_NOISE && fusion.getAltitude() <= BARO_NOISE);
+    HOST_CHECK(fusion.getVerticalSpeed() >= -BARO_NOISE && fusion.getVerticalSpeed() <= BARO_NOISE);
+}
+
+int main(void) {
+    testPad();
+    testFlight();
+    return hostResult();
+}
@@ -0,0 +1,85 @@
+/**
+ * MS5611Metrics writes the Prometheus text format with inclusive `le` bounds, a +Inf bucket, _sum and _count.
+ */
+
+#include <string>
+#include "HostTest.h"
+#include "Arduino.h"
+#include "Wire.h"
+#include "MS5611Device.h"
+#include "MS5611.h"
+#include "MS5611Metrics.h"
+
+class StringPrint : public Print {
+public:
+    std::string text;
+
+    size_t write(uint8_t value) {
+        text += (char)value;
+        return 1;
+    }
+};
+
+static void convert(MS5611 &sensor, unsigned long latency) {
+    sensor.startPressureConversion();
+    delay(latency);
+    sensor.readConversion();
+}
+
+int main(void) {
+    TwoWire bus;
+    MS5611Device device;
+    bus.attach(MS5611_ADDRESS, device);
+    MS5611 sensor(MS5611_ADDRESS, bus);
+    HostClock::set(0);
+    HOST_CHECK(sensor.begin(ULTRA_LOW_POWER));
+    sensor.resetStatistics();
+
+    MS5611Metrics metrics;
+    HOST_CHECK(metrics.add(sensor, "left"));
+    StringPrint discarded;
+    metrics.print(discarded, 1000);
+
+    convert(sensor, 1);
+    convert(sensor, 1);
+    convert(sensor, 1);
+    convert(sensor, 2);
+    convert(sensor, 3);
+    convert(sensor, 100);
+    sensor.startPressureConversion();
+    sensor.readConversion();
+    delay(1);
+
+    StringPrint output;
+    metrics.print(output, 2000);
+    const char *expected =
+        "# HELP ms5611_conversions_total Completed ADC conversions.\r\n"
+        "# TYPE ms5611_conversions_total counter\r\n"
+        "ms5611_conversions_total{sensor=\"left\"} 6\r\n"
+        "# HELP ms5611_incomplete_conversions_total ADC reads before the conversion finished.\r\n"
+        "# TYPE ms5611_incomplete_conversions_total counter\r\n"
+        "ms5611_incomplete_conversions_total{sensor=\"left\"} 1\r\n"
+        "# HELP ms5611_bus_errors_total Unacknowledged or short I2C transfers.\r\n"
+        "# TYPE ms5611_bus_errors_total counter\r\n"
+        "ms5611_bus_errors_total{sensor=\"left\"} 0\r\n"
+        "# HELP ms5611_sample_rate_millihertz Completed conversions per second since the last scrape.\r\n"
+        "# TYPE ms5611_sample_rate_millihertz gauge\r\n"
+        "ms5611_sample_rate_millihertz{sensor=\"left\"} 6000\r\n"
+        "# HELP ms5611_conversion_latency_milliseconds Time from conversion start to read.\r\n"
+        "# TYPE ms5611_conversion_latency_milliseconds histogram\r\n"
+        "ms5611_conversion_latency_milliseconds_bucket{sensor=\"left\",le=\"1\"} 3\r\n"
+        "ms5611_conversion_latency_milliseconds_bucket{sensor=\"left\",le=\"2\"} 4\r\n"
+        "ms5611_conversion_latency_milliseconds_bucket{sensor=\"left\",le=\"4\"} 5\r\n"
+        "ms5611_conversion_latency_milliseconds_bucket{sensor=\"left\",le=\"8\"} 5\r\n"
+        "ms5611_conversion_latency_milliseconds_bucket{sensor=\"left\",le=\"16\"} 5\r\n"
+        "ms5611_conversion_latency_milliseconds_bucket{sensor=\"left\",le=\"32\"} 5\r\n"
+        "ms5611_conversion_latency_milliseconds_bucket{sensor=\"left\",le=\"64\"} 5\r\n"
+        "ms5611_conversion_latency_milliseconds_bucket{sensor=\"left\",le=\"+Inf\"} 6\r\n"
+        "ms5611_conversion_latency_milliseconds_sum{sensor=\"left\"} 108\r\n"
+        "ms5611_conversion_latency_milliseconds_count{sensor=\"left\"} 6\r\n";
+    HOST_CHECK(output.text == expected);
+    if(output.text != expected) {
+        printf("%s", output.text.c_str());
+    }
+    return hostResult();
+}
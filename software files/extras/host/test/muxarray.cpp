@@ -0,0 +1,63 @@
+/**
+ * MS5611MuxArray behind a simulated TCA9548A: every sensor is read with the right pressure, a
+ * disconnected channel is reported invalid, a cycle takes two conversion times of virtual time, and
+ * `begin` fails when a channel cannot be selected.
+ */
+
+#include "HostTest.h"
+#include "Arduino.h"
+#include "Wire.h"
+#include "MS5611Device.h"
+#include "TCA9548ADevice.h"
+#include "MS5611.h"
+#include "MS5611Mux.h"
+
+int main(void) {
+    TwoWire bus;
+    TCA9548ADevice muxDevice;
+    MS5611Device devices[6];
+    bus.attach(MS5611_MUX_ADDRESS, muxDevice);
+    bus.attach(MS5611_ADDRESS, muxDevice.getPort(MS5611_ADDRESS));
+
+    MS5611Mux mux(MS5611_MUX_ADDRESS, bus);
+    MS5611MuxArray array(mux);
+    MS5611 *sensors[6];
+    for(uint8_t index = 0; index < 6; index++) {
+        uint8_t channel = 5 - index;
+        devices[index].setPressure(100000 + index * 10);
+        muxDevice.attachChannel(channel, MS5611_ADDRESS, devices[index]);
+        sensors[index] = new MS5611(MS5611_ADDRESS, bus);
+        HOST_CHECK(array.add(*sensors[index], channel));
+    }
+    HOST_CHECK(array.begin(ULTRA_HIGH_RES));
+    array.setTemperatureInterval(1);
+
+    uint64_t start = HostClock::now();
+    HOST_CHECK(array.read() == 6);
+    uint64_t elapsed = HostClock::now() - start;
+    HOST_CHECK(elapsed >= 2 * 10000 && elapsed < 2 * 10000 + 100);
+    for(uint8_t index = 0; index < 6; index++) {
+        HOST_CHECK(array.isValid(index));
+        HOST_CHECK(array.getPressure(index) == 100000 + index * 10);
+    }
+
+    devices[2].setAcknowledge(false);
+    HOST_CHECK(array.read() == 5);
+    HOST_CHECK(!array.isValid(2));
+    HOST_CHECK(array.getPressure(2) == 0);
+    HOST_CHECK(array.getPressure(3) == 100030);
+
+    MS5611 fresh(MS5611_ADDRESS, bus);
+    HOST_CHECK(!fresh.isCalibrationValid());
+
+    bus.detach(MS5611_MUX_ADDRESS);
+    HOST_CHECK(!array.begin(ULTRA_HIGH_RES));
+    bus.attach(MS5611_MUX_ADDRESS, muxDevice);
+    devices[2].setAcknowledge(true);
+    HOST_CHECK(array.begin(ULTRA_HIGH_RES));
+
+    for(uint8_t index = 0; index < 6; index++) {
+        delete sensors[index];
+    }
+    return hostResult();
+}
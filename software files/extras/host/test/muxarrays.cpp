@@ -0,0 +1,86 @@
+/**
+ * MS5611MuxArray spanning two simulated TCA9548A multiplexers on one bus, with sensors at the same
+ * address behind both: every sensor reads its own pressure and the two multiplexers are never enabled
+ * at the same time. Each of the four start and read passes of a cycle selects every channel once and
+ * disables each multiplexer once.
+ */
+
+#include "HostTest.h"
+#include "Arduino.h"
+#include "Wire.h"
+#include "MS5611Device.h"
+#include "TCA9548ADevice.h"
+#include "MS5611.h"
+#include "MS5611Mux.h"
+
+/**
+ * Upstream side of one address shared by two multiplexers. Forwards to whichever has channels enabled
+ * and counts transfers during which both had, which on real hardware would short the two segments.
+ */
+class SharedPort : public TwoWireDevice {
+public:
+    TCA9548ADevice *muxes[2];
+    uint8_t address;
+    uint32_t conflicts;
+
+    bool receive(const uint8_t *data, size_t length) {
+        TwoWireDevice *port = route();
+        return port != NULL && port->receive(data, length);
+    }
+
+    size_t request(uint8_t *data, size_t length) {
+        TwoWireDevice *port = route();
+        return port != NULL ? port->request(data, length) : 0;
+    }
+
+private:
+    TwoWireDevice *route(void) {
+        if(muxes[0]->getMask() != 0 && muxes[1]->getMask() != 0) {
+            conflicts++;
+        }
+        return &muxes[muxes[0]->getMask() != 0 ? 0 : 1]->getPort(address);
+    }
+};
+
+int main(void) {
+    TwoWire bus;
+    TCA9548ADevice muxDevices[2];
+    MS5611Device devices[16];
+    SharedPort port;
+    port.muxes[0] = &muxDevices[0];
+    port.muxes[1] = &muxDevices[1];
+    port.address = MS5611_ADDRESS;
+    port.conflicts = 0;
+    bus.attach(MS5611_MUX_ADDRESS, muxDevices[0]);
+    bus.attach(MS5611_MUX_ADDRESS + 1, muxDevices[1]);
+    bus.attach(MS5611_ADDRESS, port);
+
+    MS5611Mux first(MS5611_MUX_ADDRESS, bus);
+    MS5611Mux second(MS5611_MUX_ADDRESS + 1, bus);
+    MS5611MuxArray array(first);
+    MS5611 *sensors[16];
+    for(uint8_t index = 0; index < 16; index++) {
+        uint8_t channel = 7 - index / 2;
+        devices[index].setPressure(100000 + index * 10);
+        muxDevices[index % 2].attachChannel(channel, MS5611_ADDRESS, devices[index]);
+        sensors[index] = new MS5611(MS5611_ADDRESS, bus);
+        HOST_CHECK(array.add(*sensors[index], index % 2 == 0 ? first : second, channel));
+    }
+    HOST_CHECK(!array.add(*sensors[0], 0));
+    HOST_CHECK(array.begin(ULTRA_HIGH_RES));
+    array.setTemperatureInterval(1);
+
+    uint16_t switches = first.getSwitchCount() + second.getSwitchCount();
+    HOST_CHECK(array.read() == 16);
+    for(uint8_t index = 0; index < 16; index++) {
+        HOST_CHECK(array.getPressure(index) == 100000 + index * 10);
+    }
+    HOST_CHECK(port.conflicts == 0);
+    uint16_t cycleSwitches = first.getSwitchCount() + second.getSwitchCount() - switches;
+    HOST_CHECK(cycleSwitches == 4 * (16 + 2));
+
+    for(uint8_t index = 0; index < 16; index++) {
+        delete sensors[index];
+    }
+    return hostResult();
+}
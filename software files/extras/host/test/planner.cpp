@@ -0,0 +1,75 @@
+/**
+ * MS5611Planner against the arrays it models: on a simulated bus that charges transfer time, one
+ * MS5611Group read and one MS5611MuxArray read take the two phase times the planner predicts.
+ */
+
+#include "HostTest.h"
+#include "Arduino.h"
+#include "Wire.h"
+#include "MS5611Device.h"
+#include "TCA9548ADevice.h"
+#include "MS5611.h"
+#include "MS5611Group.h"
+#include "MS5611Mux.h"
+#include "MS5611Planner.h"
+
+static void testGroup(uint32_t busClock, MS5611_osr osr) {
+    TwoWire bus;
+    MS5611Device devices[2];
+    bus.attach(MS5611_ADDRESS, devices[0]);
+    bus.attach(MS5611_ALTERNATE_ADDRESS, devices[1]);
+    bus.setClock(busClock);
+    MS5611 first(MS5611_ADDRESS, bus);
+    MS5611 second(MS5611_ALTERNATE_ADDRESS, bus);
+    MS5611Group group;
+    group.add(first);
+    group.add(second);
+    HOST_CHECK(group.begin(osr));
+
+    bus.setTransferTiming(true);
+    uint64_t start = HostClock::now();
+    HOST_CHECK(group.readPressure() != 0);
+    uint64_t elapsed = HostClock::now() - start;
+    uint64_t expected = 2 * (uint64_t)MS5611Planner::getPhaseTime(busClock, 2, osr);
+    HOST_CHECK(elapsed + 10 >= expected && elapsed <= expected + 10);
+}
+
+static void testMuxArray(uint32_t busClock, MS5611_osr osr) {
+    TwoWire bus;
+    TCA9548ADevice muxDevice;
+    MS5611Device devices[4];
+    bus.attach(MS5611_MUX_ADDRESS, muxDevice);
+    bus.attach(MS5611_ADDRESS, muxDevice.getPort(MS5611_ADDRESS));
+    bus.setClock(busClock);
+    MS5611Mux mux(MS5611_MUX_ADDRESS, bus);
+    MS5611MuxArray array(mux);
+    MS5611 *sensors[4];
+    for(uint8_t index = 0; index < 4; index++) {
+        muxDevice.attachChannel(index, MS5611_ADDRESS, devices[index]);
+        sensors[index] = new MS5611(MS5611_ADDRESS, bus);
+        array.add(*sensors[index], index);
+    }
+    HOST_CHECK(array.begin(osr));
+    array.setTemperatureInterval(1);
+
+    bus.setTransferTiming(true);
+    uint64_t start = HostClock::now();
+    HOST_CHECK(array.read() == 4);
+    uint64_t elapsed = HostClock::now() - start;
+    uint64_t expected = 2 * (uint64_t)MS5611Planner::getPhaseTime(busClock, 4, osr, 4);
+    HOST_CHECK(elapsed + 10 >= expected && elapsed <= expected + 10);
+
+    for(uint8_t index = 0; index < 4; index++) {
+        delete sensors[index];
+    }
+}
+
+int main(void) {
+    testGroup(100000, ULTRA_HIGH_RES);
+    testGroup(100000, ULTRA_LOW_POWER);
+    testGroup(10000, ULTRA_LOW_POWER);
+    testMuxArray(100000, ULTRA_HIGH_RES);
+    testMuxArray(10000, ULTRA_LOW_POWER);
+    HOST_CHECK(MS5611Planner::getPhaseTime(100000, 0, ULTRA_HIGH_RES) == 10000);
+    return hostResult();
+}
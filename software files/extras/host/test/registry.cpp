@@ -0,0 +1,79 @@
+/**
+ * MS5611CalibrationRegistry::insertProm checks the CRC-4 layout of its policy: it accepts PROMs of the
+ * right part, checked against the reference routines of the MS5611 (AN520) and MS5637 datasheets, and
+ * rejects corrupted words and PROMs laid out for the other part.
+ */
+
+#include "HostTest.h"
+#include "MS5611Compensation.h"
+#include "MS5611CalibrationRegistry.h"
+
+static uint8_t referenceCrc(uint16_t prom[8], bool ms5637) {
+    uint16_t saved[2] = { prom[0], prom[7] };
+    uint16_t remainder = 0;
+    if(ms5637) {
+        prom[0] = prom[0] & 0x0FFF;
+        prom[7] = 0;
+    } else {
+        prom[7] = 0xFF00 & prom[7];
+    }
+    for(uint8_t count = 0; count < 16; count++) {
+        if(count % 2 == 1) {
+            remainder ^= prom[count >> 1] & 0x00FF;
+        } else {
+            remainder ^= prom[count >> 1] >> 8;
+        }
+        for(uint8_t bit = 8; bit > 0; bit--) {
+            remainder = (remainder & 0x8000) ? (remainder << 1) ^ 0x3000 : remainder << 1;
+        }
+    }
+    prom[0] = saved[0];
+    prom[7] = saved[1];
+    return (remainder >> 12) & 0x0F;
+}
+
+static uint32_t state = 1;
+
+static uint16_t random16(void) {
+    state = state * 1664525UL + 1013904223UL;
+    return (uint16_t)(state >> 16);
+}
+
+static void makeProm(uint16_t prom[8], bool ms5637) {
+    for(uint8_t index = 0; index < 8; index++) {
+        prom[index] = random16();
+    }
+    if(ms5637) {
+        prom[0] = (prom[0] & 0x0FFF) | ((uint16_t)referenceCrc(prom, true) << 12);
+    } else {
+        prom[7] = (prom[7] & 0xFFF0) | referenceCrc(prom, false);
+    }
+}
+
+int main(void) {
+    uint16_t prom[8];
+    uint16_t accepted[2] = { 0, 0 };
+    uint16_t crossAccepted = 0;
+    uint16_t corruptAccepted = 0;
+    for(uint16_t round = 0; round < 200; round++) {
+        MS5611CalibrationRegistry<MS5611Policy, 4> ms5611;
+        MS5611CalibrationRegistry<MS5637Policy, 4> ms5637;
+
+        makeProm(prom, false);
+        accepted[0] += ms5611.insertProm(prom) != NULL;
+        crossAccepted += ms5637.insertProm(prom) != NULL;
+        prom[1 + round % 6] ^= 1 << (round % 16);
+        corruptAccepted += ms5611.insertProm(prom) != NULL && ms5611.getCount() > 1;
+
+        makeProm(prom, true);
+        accepted[1] += ms5637.insertProm(prom) != NULL;
+        crossAccepted += ms5611.insertProm(prom) != NULL;
+        prom[1 + round % 6] ^= 1 << (round % 16);
+        corruptAccepted += ms5637.insertProm(prom) != NULL && ms5637.getCount() > 1;
+    }
+    HOST_CHECK(accepted[0] == 200);
+    HOST_CHECK(accepted[1] == 200);
+    HOST_CHECK(corruptAccepted == 0);
+    HOST_CHECK(crossAccepted < 60);
+    return hostResult();
+}
@@ -0,0 +1,105 @@
+/**
+ * MS5611Resampler on jittered input: a linear ramp comes out exactly, a quadratic matches the cubic
+ * interpolation within 1 LSB, output times skip a gap instead of extrapolating, and the output never
+ * lags the input by more than the documented delay.
+ */
+
+#include <math.h>
+#include "HostTest.h"
+#include "Arduino.h"
+#include "MS5611Resampler.h"
+
+static uint32_t state = 1;
+
+static uint32_t jitter(uint32_t amplitude) {
+    state = state * 1664525UL + 1013904223UL;
+    return (state >> 16) % (amplitude + 1);
+}
+
+static void testLinear(void) {
+    MS5611Resampler resampler;
+    resampler.begin(5000, LINEAR_INTERPOLATION);
+    uint32_t time = 0xFFF00000UL;
+    uint32_t anchor = time;
+    uint32_t outputs = 0;
+    bool exact = true;
+    bool aligned = true;
+    bool bounded = true;
+    for(uint16_t index = 0; index < 500; index++) {
+        time += 8000 + jitter(4000);
+        int32_t value = (int32_t)(3 * (time - anchor)) - 100000;
+        if(index == 0) {
+            anchor = time;
+            value = -100000;
+        }
+        resampler.push(time, value);
+        uint32_t timestamp = 0;
+        int32_t output;
+        bool produced = false;
+        while(resampler.read(timestamp, output)) {
+            exact = exact && output == (int32_t)(3 * (timestamp - anchor)) - 100000;
+            aligned = aligned && (timestamp - anchor) % 5000 == 0;
+            produced = true;
+            outputs++;
+        }
+        if(produced) {
+            bounded = bounded && (int32_t)(time - timestamp) < 5000;
+        }
+    }
+    HOST_CHECK(exact);
+    HOST_CHECK(aligned);
+    HOST_CHECK(bounded);
+    HOST_CHECK(outputs == (time - anchor) / 5000 + 1);
+}
+
+static void testCubic(void) {
+    MS5611Resampler resampler;
+    resampler.begin(5000, CUBIC_INTERPOLATION);
+    int32_t maximumError = 0;
+    uint32_t previous = 0;
+    uint32_t outputs = 0;
+    bool bounded = true;
+    for(int32_t index = 0; index < 300; index++) {
+        uint32_t time = (uint32_t)index * 7000;
+        resampler.push(time, 49 * index * index);
+        uint32_t timestamp;
+        int32_t output;
+        while(resampler.read(timestamp, output)) {
+            double exact = (double)timestamp * timestamp / 1000000.0;
+            int32_t error = (int32_t)fabs(output - exact + 0.5);
+            maximumError = error > maximumError ? error : maximumError;
+            previous = timestamp;
+            outputs++;
+        }
+        if(index >= 3) {
+            bounded = bounded && time - previous < 2 * 7000;
+        }
+    }
+    HOST_CHECK(maximumError <= 1);
+    HOST_CHECK(bounded);
+    HOST_CHECK(outputs == 299 * 7000 / 5000 - 2);
+}
+
+static void testGap(void) {
+    MS5611Resampler resampler;
+    resampler.begin(1000, LINEAR_INTERPOLATION);
+    resampler.push(0, 0);
+    resampler.push(1500, 1500);
+    uint32_t timestamp;
+    int32_t value;
+    HOST_CHECK(resampler.read(timestamp, value) && timestamp == 0 && value == 0);
+    HOST_CHECK(resampler.read(timestamp, value) && timestamp == 1000 && value == 1000);
+    HOST_CHECK(!resampler.read(timestamp, value));
+
+    resampler.push(20200, 20200);
+    resampler.push(21000, 21000);
+    HOST_CHECK(resampler.read(timestamp, value) && timestamp == 21000 && value == 21000);
+    HOST_CHECK(!resampler.read(timestamp, value));
+}
+
+int main(void) {
+    testLinear();
+    testCubic();
+    testGap();
+    return hostResult();
+}
@@ -0,0 +1,35 @@
+#!/bin/sh
+#
+# Builds and runs every host test against the virtual-clock shim and the simulated MS5611.
+#
+#     ./run.sh [test.cpp ...]
+#
+# Without arguments all *.cpp files in this directory are run. Exits non-zero if any test fails.
+
+DIR=$(cd "$(dirname "$0")" && pwd)
+HOST="$DIR/.."
+SRC="$DIR/../../../src"
+BUILD=$(mktemp -d)
+trap 'rm -rf "$BUILD"' EXIT
+
+if [ $# -eq 0 ]; then
+    set -- "$DIR"/*.cpp
+fi
+
+FAILED=0
+for TEST in "$@"; do
+    NAME=$(basename "$TEST" .cpp)
+    if ! ${CXX:-g++} -std=c++11 -O1 -Wall -Wextra -I"$HOST" -I"$SRC" "$TEST" "$HOST/Arduino.cpp" "$HOST/Wire.cpp" \
+        "$HOST/MS5611Device.cpp" "$HOST/TCA9548ADevice.cpp" "$SRC"/*.cpp -o "$BUILD/$NAME"; then
+        echo "$NAME: build failed"
+        FAILED=1
+        continue
+    fi
+    if "$BUILD/$NAME"; then
+        echo "$NAME: passed"
+    else
+        echo "$NAME: FAILED"
+        FAILED=1
+    fi
+done
+exit $FAILED
@@ -0,0 +1,77 @@
+/**
+ * MS5611Scheduler sample timestamps are milliseconds on the millis() time base, also across the micros()
+ * wrap, and a compensation age of 0 refreshes the temperature for every pressure conversion.
+ */
+
+#include "HostTest.h"
+#include "Arduino.h"
+#include "Wire.h"
+#include "MS5611Device.h"
+#include "MS5611.h"
+#include "MS5611Scheduler.h"
+
+static void testTimestamps(void) {
+    TwoWire bus;
+    MS5611Device device;
+    bus.attach(MS5611_ADDRESS, device);
+    MS5611 sensor(MS5611_ADDRESS, bus);
+    HostClock::set(0x100000000ULL - 5000000ULL);
+    sensor.begin(ULTRA_HIGH_RES);
+    MS5611Scheduler scheduler(sensor);
+    scheduler.begin(20000, 0, 0);
+
+    uint32_t samples = 0;
+    uint32_t previous = 0;
+    bool monotonic = true;
+    bool current = true;
+    for(uint32_t step = 0; step < 40000; step++) {
+        if(scheduler.update() & MS5611_STREAM_PRESSURE) {
+            const MS5611Sample &sample = scheduler.getSample();
+            uint32_t age = millis() - sample.timestamp;
+            current = current && age <= 12;
+            monotonic = monotonic && (samples == 0 || (int32_t)(sample.timestamp - previous) > 0);
+            previous = sample.timestamp;
+            samples++;
+        }
+        delayMicroseconds(250);
+    }
+    HOST_CHECK(samples >= 480);
+    HOST_CHECK(current);
+    HOST_CHECK(monotonic);
+    HOST_CHECK(HostClock::now() > 0x100000000ULL);
+}
+
+static void testCompensationAge(void) {
+    TwoWire bus;
+    MS5611Device device;
+    bus.attach(MS5611_ADDRESS, device);
+    MS5611 sensor(MS5611_ADDRESS, bus);
+    HostClock::set(0);
+    sensor.begin(ULTRA_HIGH_RES);
+    MS5611Scheduler scheduler(sensor);
+    scheduler.begin(50000, 0, 0, 0);
+
+    uint32_t pressureSamples = 0;
+    bool followed = true;
+    for(uint32_t step = 0; step < 8000; step++) {
+        if(step == 4000) {
+            device.setTemperature(3000);
+        }
+        if(scheduler.update() & MS5611_STREAM_PRESSURE) {
+            pressureSamples++;
+            if(step > 4000 + 400) {
+                followed = followed && scheduler.getSample().temperature == 3000;
+            }
+        }
+        delayMicroseconds(250);
+    }
+    HOST_CHECK(pressureSamples >= 38);
+    HOST_CHECK(followed);
+    HOST_CHECK(scheduler.getConversionCount() >= 2 * pressureSamples);
+}
+
+int main(void) {
+    testTimestamps();
+    testCompensationAge();
+    return hostResult();
+}
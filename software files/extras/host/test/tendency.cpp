@@ -0,0 +1,56 @@
+/**
+ * MS5611Tendency subscribed to a dispatcher fed by MS5611Scheduler, one sample per minute, follows a
+ * scripted pressure trend.
+ */
+
+#include "HostTest.h"
+#include "Arduino.h"
+#include "Wire.h"
+#include "MS5611Device.h"
+#include "MS5611.h"
+#include "MS5611Scheduler.h"
+#include "MS5611Dispatcher.h"
+#include "MS5611Tendency.h"
+
+static MS5611_tendency run(int32_t trend, int32_t &slope, uint16_t &count) {
+    TwoWire bus;
+    MS5611Device device;
+    device.setNoise(2, 7);
+    bus.attach(MS5611_ADDRESS, device);
+    MS5611 sensor(MS5611_ADDRESS, bus);
+    HostClock::set(0x100000000ULL - 3600000000ULL);
+    sensor.begin(ULTRA_HIGH_RES);
+
+    MS5611Tendency<200> tendency;
+    MS5611Dispatcher dispatcher;
+    dispatcher.subscribe(&MS5611Tendency<200>::onSample, &tendency);
+    MS5611Scheduler scheduler(sensor);
+    scheduler.setDispatcher(&dispatcher);
+    scheduler.begin(60000000UL, 0, 0);
+
+    uint64_t start = HostClock::now();
+    while(HostClock::now() - start < 4 * 3600000000ULL) {
+        int64_t elapsed = (int64_t)(HostClock::now() - start);
+        device.setPressure(101325 + (int32_t)(elapsed * trend / 10800000000LL));
+        scheduler.update();
+        delay(1);
+    }
+    slope = tendency.getSlope();
+    count = tendency.getCount();
+    return tendency.getTendency();
+}
+
+int main(void) {
+    int32_t slope;
+    uint16_t count;
+
+    HOST_CHECK(run(-200, slope, count) == FALLING);
+    HOST_CHECK(slope >= -205 && slope <= -195);
+    HOST_CHECK(count >= 179 && count <= 181);
+
+    HOST_CHECK(run(700, slope, count) == RISING_VERY_RAPIDLY);
+    HOST_CHECK(slope >= 695 && slope <= 705);
+
+    HOST_CHECK(run(0, slope, count) == STEADY);
+    return hostResult();
+}
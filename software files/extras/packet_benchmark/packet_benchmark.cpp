@@ -0,0 +1,87 @@
+/**
+ * Throughput benchmark for the MS5611Packet record format.
+ *
+ * Encodes a synthetic 100 Hz stream (a slow pressure and temperature drift with sensor noise and
+ * occasional timing jitter) and decodes it again, in keyframe-only and predictive mode. It reports the
+ * encoded size per sample, the encode and decode rates in samples per second, and checks that every
+ * decoded sample matches the encoder input. Only the packet format is built, without the Arduino core.
+ *
+ * Build and run on the host:
+ *
+ *     g++ -O2 -std=c++11 packet_benchmark.cpp ../../src/MS5611Packet.cpp -o packet_benchmark
+ *     ./packet_benchmark [samples] [seed]
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <vector>
+
+#include "../../src/MS5611Packet.h"
+
+static std::vector<MS5611Sample> generate(uint32_t count, uint32_t seed) {
+    std::vector<MS5611Sample> samples(count);
+    uint32_t state = seed;
+    uint32_t timestamp = 0;
+    for(uint32_t index = 0; index < count; index++) {
+        state = state * 1664525UL + 1013904223UL;
+        timestamp += 10 + ((state >> 28) == 0 ? 1 : 0);
+        samples[index].timestamp = timestamp & MS5611_PACKET_TIME_MASK;
+        samples[index].pressure = 101325 - (int32_t)(index / 50 % 20000) + (int32_t)((state >> 8) % 7) - 3;
+        samples[index].temperature = 2000 + (int32_t)(index / 400 % 2000) + (int32_t)((state >> 16) % 3) - 1;
+    }
+    return samples;
+}
+
+static bool run(const std::vector<MS5611Sample> &samples, bool predictive) {
+    std::vector<uint8_t> stream(samples.size() * MS5611_PACKET_SIZE);
+    MS5611PacketEncoder encoder;
+    encoder.begin(predictive);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    size_t length = 0;
+    for(size_t index = 0; index < samples.size(); index++) {
+        length += encoder.encode(samples[index], &stream[length]);
+    }
+    std::chrono::steady_clock::time_point encoded = std::chrono::steady_clock::now();
+
+    MS5611PacketDecoder decoder;
+    std::vector<MS5611Sample> decoded(samples.size());
+    size_t position = 0;
+    size_t count = 0;
+    while(position < length && count < decoded.size()) {
+        uint8_t available = length - position > 255 ? 255 : (uint8_t)(length - position);
+        uint8_t consumed = decoder.decode(&stream[position], available, decoded[count]);
+        if(consumed == 0) {
+            break;
+        }
+        position += consumed;
+        count++;
+    }
+    std::chrono::steady_clock::time_point finished = std::chrono::steady_clock::now();
+
+    size_t mismatches = samples.size() - count;
+    for(size_t index = 0; index < count; index++) {
+        if(decoded[index].timestamp != samples[index].timestamp || decoded[index].pressure != samples[index].pressure
+            || decoded[index].temperature != samples[index].temperature) {
+            mismatches++;
+        }
+    }
+
+    double encodeSeconds = std::chrono::duration<double>(encoded - start).count();
+    double decodeSeconds = std::chrono::duration<double>(finished - encoded).count();
+    printf("%-10s %6.3f bytes/sample  encode %8.2f Msamples/s  decode %8.2f Msamples/s  mismatches %lu\n",
+        predictive ? "predictive" : "keyframe", (double)length / samples.size(),
+        samples.size() / encodeSeconds / 1e6, samples.size() / decodeSeconds / 1e6, (unsigned long)mismatches);
+    return mismatches == 0;
+}
+
+int main(int argc, char **argv) {
+    uint32_t count = argc > 1 ? (uint32_t)strtoul(argv[1], NULL, 0) : 10000000UL;
+    uint32_t seed = argc > 2 ? (uint32_t)strtoul(argv[2], NULL, 0) : 1;
+    std::vector<MS5611Sample> samples = generate(count, seed);
+    bool passed = run(samples, false);
+    passed = run(samples, true) && passed;
+    return passed ? 0 : 1;
+}
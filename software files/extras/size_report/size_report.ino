@@ -0,0 +1,31 @@
+/**
+ * Footprint probe for the MS5611 build options.
+ *
+ * Exercises the integer API in every configuration and the double API where it is compiled in, so
+ * each option removes exactly the code it guards. Compiled by size_report.sh; not meant to be run.
+ */
+
+#include <MS5611.h>
+
+MS5611 ms5611;
+
+void setup() {
+    Serial.begin(9600);
+    ms5611.begin(ULTRA_HIGH_RES);
+}
+
+void loop() {
+    uint32_t D1 = ms5611.readRawPressure();
+    uint32_t D2 = ms5611.readRawTemperature();
+    int32_t pressure = ms5611.compensatePressure(D1, D2, true);
+
+    Serial.println(pressure);
+    Serial.println(ms5611.compensateTemperature(D2, true));
+#ifndef MS5611_NO_FLOAT
+    Serial.println(ms5611.readTemperature(true));
+#endif
+#ifndef MS5611_NO_ALTITUDE
+    Serial.println(ms5611.getAltitude(pressure));
+#endif
+    delay(1000);
+}
@@ -0,0 +1,52 @@
+#!/bin/sh
+#
+# Reports flash and RAM usage of the MS5611 build options.
+#
+# Compiles size_report.ino once per configuration with arduino-cli and prints the usage and the
+# saving against the full build. Requires arduino-cli with the core of the target board installed.
+#
+#     ./size_report.sh [fqbn]
+#
+# The default board is arduino:avr:uno.
+
+FQBN=${1:-arduino:avr:uno}
+if ! command -v arduino-cli >/dev/null 2>&1; then
+    echo "arduino-cli not found in PATH" >&2
+    exit 1
+fi
+DIR=$(cd "$(dirname "$0")" && pwd)
+LIBRARY=$(cd "$DIR/../.." && pwd)
+
+measure() {
+    arduino-cli compile --fqbn "$FQBN" --library "$LIBRARY" \
+        --build-property "build.extra_flags=$1" "$DIR" 2>&1 |
+        sed -n 's/^Sketch uses \([0-9]*\) bytes.*/\1/p; s/^Global variables use \([0-9]*\) bytes.*/\1/p' |
+        tr '\n' ' '
+}
+
+FULL=$(measure "")
+set -- $FULL
+if [ -z "$2" ]; then
+    echo "compilation failed for $FQBN" >&2
+    exit 1
+fi
+FULL_FLASH=$1
+FULL_RAM=$2
+
+printf '%-16s %8s %8s %8s %8s\n' "configuration" "flash" "saved" "ram" "saved"
+printf '%-16s %8s %8s %8s %8s\n' "full" "$FULL_FLASH" "0" "$FULL_RAM" "0"
+
+for CONFIG in \
+    "no-second-order:-DMS5611_NO_SECOND_ORDER" \
+    "no-altitude:-DMS5611_NO_ALTITUDE" \
+    "no-float:-DMS5611_NO_FLOAT" \
+    "no-statistics:-DMS5611_NO_STATISTICS" \
+    "minimal:-DMS5611_NO_FLOAT -DMS5611_NO_SECOND_ORDER -DMS5611_NO_STATISTICS"; do
+    NAME=${CONFIG%%:*}
+    set -- $(measure "${CONFIG#*:}")
+    if [ -z "$2" ]; then
+        echo "compilation failed for $NAME" >&2
+        exit 1
+    fi
+    printf '%-16s %8s %8s %8s %8s\n' "$NAME" "$1" "$((FULL_FLASH - $1))" "$2" "$((FULL_RAM - $2))"
+done
@@ -1,5 +1,21 @@
 #include "MS5611.h"
 
+/*
+ * Datasheet example calculations, checked at compile time. MS5607 and MS5637 share their example values.
+ */
+static constexpr uint16_t MS5611_EXAMPLE_COEFFICIENTS[6] = { 40127, 36924, 23317, 23282, 33464, 28312 };
+static constexpr uint16_t MS5607_EXAMPLE_COEFFICIENTS[6] = { 46372, 43981, 29059, 27842, 31553, 28165 };
+
+static_assert(MS5611Compensation<MS5611Policy>::getDeltaTemperature(MS5611_EXAMPLE_COEFFICIENTS, 8569150) == 2366, "MS5611 dT");
+static_assert(MS5611Compensation<MS5611Policy>::temperature(MS5611_EXAMPLE_COEFFICIENTS, 8569150, true) == 2007, "MS5611 TEMP");
+static_assert(MS5611Compensation<MS5611Policy>::getOffset(MS5611_EXAMPLE_COEFFICIENTS, 2366, true) == 2420281617LL, "MS5611 OFF");
+static_assert(MS5611Compensation<MS5611Policy>::getSensitivity(MS5611_EXAMPLE_COEFFICIENTS, 2366, true) == 1315097036LL, "MS5611 SENS");
+static_assert(MS5611Compensation<MS5611Policy>::pressure(MS5611_EXAMPLE_COEFFICIENTS, 9085466, 8569150, true) == 100009, "MS5611 P");
+static_assert(MS5611Compensation<MS5607Policy>::temperature(MS5607_EXAMPLE_COEFFICIENTS, 8077636, true) == 2000, "MS5607 TEMP");
+static_assert(MS5611Compensation<MS5607Policy>::pressure(MS5607_EXAMPLE_COEFFICIENTS, 6465444, 8077636, true) == 110002, "MS5607 P");
+static_assert(MS5611Compensation<MS5637Policy>::temperature(MS5607_EXAMPLE_COEFFICIENTS, 8077636, true) == 2000, "MS5637 TEMP");
+static_assert(MS5611Compensation<MS5637Policy>::pressure(MS5607_EXAMPLE_COEFFICIENTS, 6465444, 8077636, true) == 110002, "MS5637 P");
+
 /**
  * @brief Performs initialization routines.
  *
@@ -12,21 +28,86 @@
  * retrieves calibration data and returns a boolean value indicating the success of the operation.
  */
 bool MS5611::begin(MS5611_osr osr) {
-    Wire.begin();
+    beginReset(osr);
+
+    delay(MS5611_RESET_DELAY);
+
+    getCalibrationData();
+
+    return true;
+}
+
+/**
+ * @brief Starts the bus, resets the sensor and sets the oversampling rate without waiting.
+ *
+ * @param osr Oversampling rate for MS5611.
+ *
+ * This function performs the first half of `begin`. The sensor reloads its PROM after the reset, so
+ * `getCalibrationData` may only be called once MS5611_RESET_DELAY milliseconds have passed. Splitting
+ * the two steps lets several sensors share a single reset wait.
+ */
+void MS5611::beginReset(MS5611_osr osr) {
+    wire->begin();
 
     performReset();
 
     setOversampling(osr);
+}
 
-    delay(100);
-
-    getCalibrationData();
+/**
+ * @brief Creates a driver instance for one MS5611 sensor.
+ *
+ * @param address I2C address of the sensor, MS5611_ADDRESS (CSB low) or MS5611_ALTERNATE_ADDRESS (CSB high).
+ * @param wire I2C bus the sensor is connected to.
+ *
+ * Several instances may share a bus when their addresses differ, or use separate buses. The calibration
+ * coefficients start at 0, so `isCalibrationValid` is false until they have been read or supplied.
+ */
+MS5611::MS5611(uint8_t address, TwoWire &wire) {
+    this->address = address;
+    this->wire = &wire;
+    this->formulas = NULL;
+    memset(filterCoefficient, 0, sizeof(filterCoefficient));
+#ifndef MS5611_NO_STATISTICS
+    resetStatistics();
+    conversionStart = 0;
+#endif
+}
 
-    return true;
+/**
+ * @brief Selects the compensation formulas used by `compensateTemperature` and `compensatePressure`.
+ *
+ * @param formulas Formulas of another part of the family, or NULL for the MS5611.
+ *
+ * This function is used by MS56xx to install the formulas of another part of the family, so that code
+ * holding an MS5611 reference, such as MS5611Group, compensates every sensor correctly. A plain MS5611
+ * keeps NULL and calls the MS5611 formulas directly, so it pays no indirect call.
+ */
+void MS5611::setCompensation(const MS5611CompensationFormulas *formulas) {
+    this->formulas = formulas;
 }
 
-MS5611::MS5611() {
-    
+/**
+ * @brief Initializes the driver from previously saved calibration data.
+ *
+ * @param coefficients Calibration coefficients C1 to C6, e.g. from `getCalibrationCoefficient` before deep sleep.
+ * @param osr Oversampling rate for MS5611.
+ * @return A boolean value indicating whether the coefficients are plausible.
+ *
+ * This function starts the Wire library and sets the oversampling rate, but neither resets the sensor nor
+ * reads its PROM. It is meant for waking from deep sleep while the sensor stayed powered, where the reset
+ * wait and PROM reads of `begin` would dominate the wake time.
+ */
+bool MS5611::beginWithCalibration(const uint16_t coefficients[6], MS5611_osr osr) {
+    wire->begin();
+
+    setOversampling(osr);
+
+    for(uint8_t offset = 0; offset < 6; offset++) {
+        filterCoefficient[offset] = coefficients[offset];
+    }
+
+    return isCalibrationValid();
 }
 
 /**
@@ -87,9 +168,9 @@ uint8_t MS5611::getOversampling(void) {
  * the reset command (MS5611_RESET). Finally, it ends the transmission.
  */
 void MS5611::performReset(void) {
-    Wire.beginTransmission(MS5611_ADDRESS);
-    Wire.write(MS5611_RESET);
-    Wire.endTransmission();
+    wire->beginTransmission(address);
+    wire->write(MS5611_RESET);
+    endTransmission();
 }
 
 /**
@@ -103,14 +184,72 @@ void MS5611::performReset(void) {
  */ 
 void MS5611::getCalibrationData(void) {
     for(uint8_t offset = 0; offset < 6; offset++) {
-        filterCoefficient[offset] = readRegister16(MS5611_READ_PROM + (offset * 2));
+        readCalibrationCoefficient(offset);
+    }
+}
+
+/**
+ * @brief Retrieves a single calibration coefficient from the MS5611 sensor.
+ *
+ * @param index Coefficient index, 0 for C1 to 5 for C6.
+ * @return The coefficient value.
+ *
+ * This function reads one PROM word and stores it in the `filterCoefficient` array. It allows callers
+ * to interleave PROM reads of several sensors.
+ */
+uint16_t MS5611::readCalibrationCoefficient(uint8_t index) {
+    if(index >= 6) {
+        return 0;
     }
+    filterCoefficient[index] = readRegister16(MS5611_READ_PROM + (index * 2));
+    return filterCoefficient[index];
+}
+
+/**
+ * @brief Retrieves a calibration coefficient held by the driver.
+ *
+ * @param index Coefficient index, 0 for C1 to 5 for C6.
+ * @return The coefficient value, or 0 for an invalid index.
+ */
+uint16_t MS5611::getCalibrationCoefficient(uint8_t index) {
+    if(index >= 6) {
+        return 0;
+    }
+    return filterCoefficient[index];
+}
+
+/**
+ * @brief Reads all eight PROM words.
+ *
+ * @param prom Receives the factory word, C1 to C6 and the word holding the CRC-4 in its low nibble.
+ *
+ * This function does not change the calibration held by the driver. It is meant for logs that record the
+ * PROM, so offline tools can verify it with MS5611Policy::checkProm before using the coefficients.
+ */
+void MS5611::readProm(uint16_t prom[8]) {
+    for(uint8_t offset = 0; offset < 8; offset++) {
+        prom[offset] = readRegister16(MS5611_PROM_BASE + (offset * 2));
+    }
+}
+
+/**
+ * @brief Checks whether plausible calibration data was read.
+ *
+ * @return False if any coefficient reads as 0x0000 or 0xFFFF, which means the sensor did not answer.
+ */
+bool MS5611::isCalibrationValid(void) {
+    for(uint8_t offset = 0; offset < 6; offset++) {
+        if(filterCoefficient[offset] == 0x0000 || filterCoefficient[offset] == 0xFFFF) {
+            return false;
+        }
+    }
+    return true;
 }
 
 /**
  * @brief Reads the raw temperature value from the MS5611 sensor.
  *
- * @return The raw temperature value as a 32-bit unsigned integer.
+ * @return The raw temperature value as a 32-bit unsigned integer, or 0 if the sensor did not answer.
  *
  * This function reads the raw temperature value from the MS5611 sensor. It starts a transmission
  * using the Wire library to the MS5611 sensor's address and writes the conversion command (MS5611_CONV_D2)
@@ -119,17 +258,15 @@ void MS5611::getCalibrationData(void) {
  * (MS5611_ADC_READ) and returns it as a 32-bit unsigned integer.
  */
 uint32_t MS5611::readRawTemperature(void) {
-    Wire.beginTransmission(MS5611_ADDRESS);
-    Wire.write(MS5611_CONV_D2 + userOversamplingRate);
-    Wire.endTransmission();
+    startTemperatureConversion();
     delay(counter);
-    return readRegister24(MS5611_ADC_READ);
+    return readConversion();
 }
 
 /**
  * @brief Reads the raw pressure value from the MS5611 sensor.
  *
- * @return The raw pressure value as a 32-bit unsigned integer.
+ * @return The raw pressure value as a 32-bit unsigned integer, or 0 if the sensor did not answer.
  *
  * This function reads the raw pressure value from the MS5611 sensor. It starts a transmission
  * using the Wire library to the MS5611 sensor's address and writes the conversion command (MS5611_CONV_D1)
@@ -138,13 +275,88 @@ uint32_t MS5611::readRawTemperature(void) {
  * (MS5611_ADC_READ) and returns it as a 32-bit unsigned integer.
  */
 uint32_t MS5611::readRawPressure(void) {
-    Wire.beginTransmission(MS5611_ADDRESS);
-    Wire.write(MS5611_CONV_D1 + userOversamplingRate);
-    Wire.endTransmission();
+    startPressureConversion();
     delay(counter);
-    return readRegister24(MS5611_ADC_READ);
+    return readConversion();
+}
+
+/**
+ * @brief Starts a temperature (D2) conversion without waiting for it.
+ *
+ * This function writes the conversion command (MS5611_CONV_D2) along with the user-specified oversampling
+ * rate and returns immediately. The result must be collected with `readConversion` once at least
+ * `getConversionTime` milliseconds have passed. This allows conversions on several sensors to run at once.
+ */
+void MS5611::startTemperatureConversion(void) {
+    wire->beginTransmission(address);
+    wire->write(MS5611_CONV_D2 + userOversamplingRate);
+    endTransmission();
+#ifndef MS5611_NO_STATISTICS
+    conversionStart = micros();
+#endif
+}
+
+/**
+ * @brief Starts a pressure (D1) conversion without waiting for it.
+ *
+ * This function writes the conversion command (MS5611_CONV_D1) along with the user-specified oversampling
+ * rate and returns immediately. The result must be collected with `readConversion` once at least
+ * `getConversionTime` milliseconds have passed.
+ */
+void MS5611::startPressureConversion(void) {
+    wire->beginTransmission(address);
+    wire->write(MS5611_CONV_D1 + userOversamplingRate);
+    endTransmission();
+#ifndef MS5611_NO_STATISTICS
+    conversionStart = micros();
+#endif
 }
 
+/**
+ * @brief Reads the result of the last started conversion.
+ *
+ * @return The 24-bit ADC value, or 0 if the conversion had not finished or the sensor did not answer.
+ *
+ * This function reads a 24-bit value from the ADC read register (MS5611_ADC_READ). The sensor returns 0
+ * when the register is read before the conversion completes, and a NACKed or short transfer is reported
+ * as 0 as well, so callers only need to check for 0. Unless built with MS5611_NO_STATISTICS, an answered
+ * read is counted as a conversion or an incomplete conversion, and the time since the conversion was
+ * started is added to the latency histogram.
+ */
+uint32_t MS5611::readConversion(void) {
+    uint32_t value;
+    bool answered = readRegister24(MS5611_ADC_READ, value);
+#ifndef MS5611_NO_STATISTICS
+    if(!answered) {
+        return 0;
+    } else if(value == 0) {
+        statistics.incompleteConversions++;
+    } else {
+        statistics.conversions++;
+        uint32_t latency = (uint32_t)(micros() - conversionStart) / 1000;
+        uint8_t bucket = 0;
+        while(bucket < MS5611_LATENCY_BUCKETS - 1 && latency > (1UL << bucket)) {
+            bucket++;
+        }
+        statistics.latency[bucket]++;
+        statistics.latencySum += latency;
+    }
+#else
+    (void)answered;
+#endif
+    return value;
+}
+
+/**
+ * @brief Retrieves the wait time for one conversion at the current oversampling rate.
+ *
+ * @return The conversion time in milliseconds.
+ */
+uint8_t MS5611::getConversionTime(void) {
+    return counter;
+}
+
+#ifndef MS5611_NO_FLOAT
 /**
  * @brief Reads the temperature from the MS5611 sensor.
  *
@@ -161,20 +373,10 @@ uint32_t MS5611::readRawPressure(void) {
  */
 double MS5611::readTemperature(bool compensation) {
     uint32_t D2 = readRawTemperature();
-    int32_t dT = D2 - (uint32_t)filterCoefficient[4] * 256;
-
-    int32_t temperature = 2000 + ((int64_t) dT * filterCoefficient[5]) / 8388608;
 
-    temperature2 = 0;
-    if(compensation) {
-        if(temperature2 < 2000) {
-            temperature2 = (dT * dT) / pow(2, 31);
-        }
-    }
-    temperature = temperature - temperature2;
-
-    return ((double)temperature/100);
+    return ((double)compensateTemperature(D2, compensation)/100);
 }
+#endif
 
 /**
  * @brief Reads the pressure from the MS5611 sensor.
@@ -195,33 +397,76 @@ int32_t MS5611::readPressure(bool compensation) {
     uint32_t D1 = readRawPressure(); // D1 is a variable used for pressure measurement
 
     uint32_t D2 = readRawTemperature(); // D2 is a variable used for temperature measurement
-    int32_t dT = D2 - (uint32_t)filterCoefficient[4] * 256;
 
-    int64_t offset = (int64_t)filterCoefficient[1] * 65536 + (int64_t)filterCoefficient[3] * dT / 128;
-    int64_t sensitivity = (int64_t)filterCoefficient[0] * 32768 + (int64_t)filterCoefficient[2] * dT / 256;
+    return compensatePressure(D1, D2, compensation);
+}
 
-    if(compensation) {
-        int32_t temperature = 2000 + ((int64_t) dT * filterCoefficient[5]) / 8388608;
+/**
+ * @brief Reads pressure and temperature from one conversion pair.
+ *
+ * @param sample Receives the timestamp in milliseconds, the pressure in Pa and the temperature in
+ * hundredths of a degree Celsius.
+ * @param compensation Flag to enable second order compensation.
+ * @return A boolean value indicating whether the sensor delivered both raw values.
+ *
+ * Unlike calling `readPressure` and `readTemperature`, this function runs a single D1 and D2 conversion
+ * and derives both values from them.
+ */
+bool MS5611::readSample(MS5611Sample &sample, bool compensation) {
+    uint32_t D1 = readRawPressure();
+    uint32_t D2 = readRawTemperature();
+    if(D1 == 0 || D2 == 0) {
+        return false;
+    }
 
-        offset2 = 0;
-        sensitivity2 = 0;
+    sample.timestamp = millis();
+    sample.pressure = compensatePressure(D1, D2, compensation);
+    sample.temperature = compensateTemperature(D2, compensation);
+    return true;
+}
 
-        if(temperature < 2000) {
-            offset2 = 5 * ((temperature - 2000) * (temperature - 2000)) / 2;
-	        sensitivity2 = 5 * ((temperature - 2000) * (temperature - 2000)) / 4;
-        }
-        if(temperature < -1500) {
-        	offset2 = offset2 + 7 * ((temperature + 1500) * (temperature + 1500));
-	        sensitivity2 = sensitivity2 + 11 * ((temperature + 1500) * (temperature + 1500)) / 2;
-        }
-        offset = offset - offset2;
-	    sensitivity = sensitivity - sensitivity2;
+/**
+ * @brief Calculates the temperature from a raw temperature value.
+ *
+ * @param D2 Raw temperature value returned by `readRawTemperature` or `readConversion`.
+ * @param compensation Flag to enable second order temperature compensation.
+ * @return The temperature in hundredths of a degree Celsius.
+ *
+ * This function calculates the temperature difference (dT) by subtracting a scaled coefficient from the raw
+ * temperature and then the temperature from dT and the temperature coefficient. If compensation is enabled,
+ * the second order correction of the part is subtracted; for the MS5611 this applies below 20 °C. The
+ * formulas are provided by MS5611Compensation; other parts than the MS5611 are reached through the
+ * formulas installed by MS56xx.
+ */
+int32_t MS5611::compensateTemperature(uint32_t D2, bool compensation) {
+    if(formulas != NULL) {
+        return formulas->temperature(filterCoefficient, D2, compensation);
     }
-    
-    uint32_t pres = (D1 * sensitivity / 2097152 - offset) / 32768;
-    return pres;
+    return MS5611Compensation<MS5611Policy>::temperature(filterCoefficient, D2, compensation);
 }
 
+/**
+ * @brief Calculates the pressure from raw pressure and temperature values.
+ *
+ * @param D1 Raw pressure value returned by `readRawPressure` or `readConversion`.
+ * @param D2 Raw temperature value returned by `readRawTemperature` or `readConversion`.
+ * @param compensation Flag to enable second order pressure compensation.
+ * @return The pressure in Pa.
+ *
+ * This function calculates the temperature difference (dT), the offset and the sensitivity from the
+ * calibration coefficients. If compensation is enabled, it subtracts the second order corrections (offset2
+ * and sensitivity2) of the part; for the MS5611 these apply below 20 °C and -15 °C. Finally it calculates
+ * the pressure from the raw pressure, sensitivity and offset. The formulas are provided by
+ * MS5611Compensation; other parts than the MS5611 are reached through the formulas installed by MS56xx.
+ */
+int32_t MS5611::compensatePressure(uint32_t D1, uint32_t D2, bool compensation) {
+    if(formulas != NULL) {
+        return formulas->pressure(filterCoefficient, D1, D2, compensation);
+    }
+    return MS5611Compensation<MS5611Policy>::pressure(filterCoefficient, D1, D2, compensation);
+}
+
+#ifndef MS5611_NO_ALTITUDE
 /**
  * @brief Calculates the altitude based on the pressure and sea level pressure.
  *
@@ -253,12 +498,67 @@ double MS5611::getAltitude(double pressure, double seaLevelPressure) {
 double MS5611::getSeaLevel(double pressure, double altitude) {
     return ((double)pressure / pow(1.0f - ((double)altitude / 44330.0f), 5.255f));
 }
+#endif
+
+#ifndef MS5611_NO_STATISTICS
+/**
+ * @brief Retrieves the bus and conversion counters.
+ *
+ * @return The counters since construction or the last `resetStatistics`. `conversions` counts completed
+ * ADC reads, `incompleteConversions` reads that returned 0 because the conversion had not finished and
+ * `busErrors` transfers the sensor did not acknowledge or answered short. Bucket i of `latency` counts
+ * conversions read at most 2^i whole milliseconds after they were started, and more than 2^(i-1) for
+ * i > 0; the last bucket holds everything slower than 2^(MS5611_LATENCY_BUCKETS - 2). `latencySum` is
+ * the total latency of the completed conversions in milliseconds.
+ */
+const MS5611Statistics &MS5611::getStatistics(void) {
+    return statistics;
+}
+
+/**
+ * @brief Clears the bus and conversion counters.
+ */
+void MS5611::resetStatistics(void) {
+    memset(&statistics, 0, sizeof(statistics));
+}
+#endif
+
+/**
+ * @brief Ends a write transfer and counts a missing acknowledge as a bus error.
+ *
+ * @return False if the sensor did not acknowledge.
+ */
+bool MS5611::endTransmission(void) {
+    if(wire->endTransmission() != 0) {
+#ifndef MS5611_NO_STATISTICS
+        statistics.busErrors++;
+#endif
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Requests bytes from the sensor and counts a short answer as a bus error.
+ *
+ * @param count Number of bytes to read.
+ * @return False if the sensor answered fewer bytes.
+ */
+bool MS5611::requestFrom(uint8_t count) {
+    if(wire->requestFrom(address, count) != count) {
+#ifndef MS5611_NO_STATISTICS
+        statistics.busErrors++;
+#endif
+        return false;
+    }
+    return true;
+}
 
 /**
  * @brief Reads a 16-bit register value from the MS5611 sensor.
  *
  * @param reg The register address to read from.
- * @return The register value as a 16-bit unsigned integer.
+ * @return The register value as a 16-bit unsigned integer, or 0 if the sensor did not answer.
  *
  * This function reads a 16-bit register value from the MS5611 sensor. It begins by initiating a transmission to the
  * MS5611 sensor using the I2C communication protocol. It sends the register address to read from. After ending the
@@ -268,14 +568,14 @@ double MS5611::getSeaLevel(double pressure, double altitude) {
  */
 uint16_t MS5611::readRegister16(uint8_t reg) {
     uint16_t value;
-    Wire.beginTransmission(MS5611_ADDRESS);
-    Wire.write(reg);
-    Wire.endTransmission();
-
-    Wire.requestFrom(MS5611_ADDRESS, 2);
+    wire->beginTransmission(address);
+    wire->write(reg);
+    if(!endTransmission() || !requestFrom(2)) {
+        return 0;
+    }
 
-    uint8_t valueHigh = Wire.read();
-    uint8_t valueLow = Wire.read();
+    uint8_t valueHigh = wire->read();
+    uint8_t valueLow = wire->read();
 // if value = 0 it will be false
     value = (valueHigh << 8) | valueLow;
     return value;
@@ -285,26 +585,28 @@ uint16_t MS5611::readRegister16(uint8_t reg) {
  * @brief Reads a 24-bit register value from the MS5611 sensor.
  *
  * @param reg The register address to read from.
- * @return The register value as a 24-bit unsigned integer.
+ * @param value Receives the register value as a 24-bit unsigned integer, or 0 if the sensor did not answer.
+ * @return False if the sensor did not acknowledge the command or answered fewer than 3 bytes.
  *
  * This function reads a 24-bit register value from the MS5611 sensor. It begins by initiating a transmission to the
  * MS5611 sensor using the I2C communication protocol. It sends the register address to read from. After ending the
  * transmission, it requests 3 bytes of data from the MS5611 sensor. It then reads the extra byte, high byte, and low
- * byte of the register value from the Wire buffer. Finally, it combines the bytes to form the 24-bit register value
- * and returns it as a 24-bit unsigned integer.
+ * byte of the register value from the Wire buffer. Finally, it combines the bytes to form the 24-bit register value.
+ * A failed transfer is reported instead of decoding the bytes, because `Wire.read()` returns -1 for missing bytes,
+ * which would read as 0xFFFFFF.
  */
-uint32_t MS5611::readRegister24(uint8_t reg) {
-    uint32_t value;
-    Wire.beginTransmission(MS5611_ADDRESS);
-    Wire.write(reg);
-    Wire.endTransmission();
-
-    Wire.requestFrom(MS5611_ADDRESS, 2);
+bool MS5611::readRegister24(uint8_t reg, uint32_t &value) {
+    value = 0;
+    wire->beginTransmission(address);
+    wire->write(reg);
+    if(!endTransmission() || !requestFrom(3)) {
+        return false;
+    }
 
-    uint8_t valueXbyte = Wire.read();
-    uint8_t valueHigh = Wire.read();
-    uint8_t valueLow = Wire.read();
+    uint8_t valueXbyte = wire->read();
+    uint8_t valueHigh = wire->read();
+    uint8_t valueLow = wire->read();
 
     value = ((int32_t)valueXbyte << 16) | ((int32_t)valueHigh << 8) | valueLow;
-    return value;
+    return true;
 }
\ No newline at end of file
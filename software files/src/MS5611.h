@@ -4,13 +4,44 @@
 #include "Arduino.h"
 #include "Wire.h"
 
+/*
+ * Build options, set through the compiler flags (e.g. build_flags in PlatformIO):
+ *
+ * MS5611_NO_FLOAT          removes every double API (readTemperature, getAltitude, getSeaLevel); implies MS5611_NO_ALTITUDE
+ * MS5611_NO_ALTITUDE       removes getAltitude, getSeaLevel and the pow() dependency
+ * MS5611_NO_SECOND_ORDER   compiles out the second order compensation; the compensation flags are ignored
+ * MS5611_NO_STATISTICS     removes the bus and conversion counters (getStatistics, resetStatistics)
+ *
+ * Table sizes, fixed at compile time so no component allocates memory:
+ *
+ * MS5611_GROUP_MAX_SENSORS            sensors per MS5611Group (default 3)
+ * MS5611_MUX_ARRAY_MAX_SENSORS        sensors per MS5611MuxArray (default 16)
+ * MS5611_DISPATCHER_MAX_SUBSCRIBERS   subscribers per MS5611Dispatcher (default 8)
+ * MS5611_METRICS_MAX_SENSORS          sensors per MS5611Metrics (default 8)
+ *
+ * MS5611_NO_STATISTICS and the table sizes change the layout of the classes, so they must be set for the
+ * whole build and never #defined in a sketch or a single source file: translation units that see different
+ * values disagree on object sizes and member offsets, and the program misbehaves without a diagnostic.
+ */
+#if defined(MS5611_NO_FLOAT) && !defined(MS5611_NO_ALTITUDE)
+#define MS5611_NO_ALTITUDE
+#endif
+
+#include "MS5611Compensation.h"
+#include "MS5611Sample.h"
+
 #define MS5611_ADDRESS 0x77
+#define MS5611_ALTERNATE_ADDRESS 0x76
 
 #define MS5611_ADC_READ 0x00
 #define MS5611_RESET 0x1E
 #define MS5611_CONV_D1 0x40
 #define MS5611_CONV_D2 0x50
 #define MS5611_READ_PROM 0xA2
+#define MS5611_PROM_BASE 0xA0
+
+#define MS5611_RESET_DELAY 100
+#define MS5611_LATENCY_BUCKETS 8
 
     enum MS5611_osr {
         ULTRA_HIGH_RES   = 0x08,
@@ -20,32 +51,77 @@
         ULTRA_LOW_POWER  = 0x00
     };
 
+typedef int32_t (*MS5611TemperatureCompensation)(const uint16_t *coefficients, uint32_t D2, bool compensation);
+typedef int32_t (*MS5611PressureCompensation)(const uint16_t *coefficients, uint32_t D1, uint32_t D2, bool compensation);
+
+struct MS5611CompensationFormulas {
+    MS5611TemperatureCompensation temperature;
+    MS5611PressureCompensation pressure;
+};
+
+struct MS5611Statistics {
+    uint32_t conversions;
+    uint32_t incompleteConversions;
+    uint32_t busErrors;
+    uint32_t latency[MS5611_LATENCY_BUCKETS];
+    uint32_t latencySum;
+};
+
 class MS5611 {
 public:
-    MS5611();
+    MS5611(uint8_t address = MS5611_ADDRESS, TwoWire &wire = Wire);
     bool begin(MS5611_osr osr = HIGH_RES);
+    void beginReset(MS5611_osr osr = HIGH_RES);
+    bool beginWithCalibration(const uint16_t coefficients[6], MS5611_osr osr = HIGH_RES);
     uint32_t readRawTemperature(void);
     uint32_t readRawPressure(void);
+#ifndef MS5611_NO_FLOAT
     double readTemperature(bool compensation = false);
+#endif
     int32_t readPressure(bool compensation = false);
+    bool readSample(MS5611Sample &sample, bool compensation = false);
+    void startTemperatureConversion(void);
+    void startPressureConversion(void);
+    uint32_t readConversion(void);
+    uint8_t getConversionTime(void);
+    int32_t compensateTemperature(uint32_t D2, bool compensation = false);
+    int32_t compensatePressure(uint32_t D1, uint32_t D2, bool compensation = false);
+#ifndef MS5611_NO_ALTITUDE
     double getAltitude(double pressure, double seaLevelPressure = 101325);
     double getSeaLevel(double pressure, double altitude);
+#endif
     void setOversampling(MS5611_osr osr);
     uint8_t getOversampling(void);
     void getCalibrationData(void);
-private:
+    uint16_t readCalibrationCoefficient(uint8_t index);
+    uint16_t getCalibrationCoefficient(uint8_t index);
+    void readProm(uint16_t prom[8]);
+    bool isCalibrationValid(void);
+#ifndef MS5611_NO_STATISTICS
+    const MS5611Statistics &getStatistics(void);
+    void resetStatistics(void);
+#endif
+protected:
     uint16_t filterCoefficient[6];
+
+    void setCompensation(const MS5611CompensationFormulas *formulas);
+private:
+    TwoWire *wire;
+    uint8_t address;
+    const MS5611CompensationFormulas *formulas;
     uint8_t counter;
     uint8_t userOversamplingRate;
-    int32_t temperature2;
-    int64_t offset2, sensitivity2;
-    MS5611_osr osr;
+#ifndef MS5611_NO_STATISTICS
+    MS5611Statistics statistics;
+    uint32_t conversionStart;
+#endif
 
     void performReset(void);
-
+    bool endTransmission(void);
+    bool requestFrom(uint8_t count);
 
 	uint16_t readRegister16(uint8_t reg);
-	uint32_t readRegister24(uint8_t reg);
+	bool readRegister24(uint8_t reg, uint32_t &value);
 };
 
 #endif
\ No newline at end of file
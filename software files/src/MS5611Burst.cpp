@@ -0,0 +1,151 @@
+#include "MS5611Burst.h"
+
+/**
+ * @brief Creates a burst sampler for battery nodes that sleep between samples.
+ *
+ * @param sensor Sensor to sample. It must stay powered during sleep for its state to remain valid.
+ * @param filter Optional change filter whose state is carried across sleep cycles.
+ */
+MS5611Burst::MS5611Burst(MS5611 &sensor, MS5611ChangeFilter *filter) {
+    this->sensor = &sensor;
+    this->filter = filter;
+    temperature = 0;
+    timestamp = 0;
+    temperatureInterval = 1;
+    temperatureCounter = 0;
+    restored = false;
+}
+
+/**
+ * @brief Initializes the sensor after waking, restoring a checkpoint when possible.
+ *
+ * @param checkpoint Checkpoint written by `sleep`, usually kept in RTC or otherwise retained memory.
+ * @param osr Oversampling rate for MS5611. A checkpoint taken with a different rate is discarded.
+ * @return A boolean value indicating whether the sensor is ready to sample.
+ *
+ * If the checkpoint is intact, this function loads the calibration, the last temperature reading and the
+ * filter state from it and skips the reset wait and PROM reads. Otherwise, e.g. after a cold boot where
+ * retained memory holds garbage, it falls back to a full `begin`.
+ */
+bool MS5611Burst::wake(const MS5611Checkpoint &checkpoint, MS5611_osr osr) {
+    restored = checkpoint.magic == MS5611_CHECKPOINT_MAGIC
+        && checkpoint.checksum == getChecksum(checkpoint)
+        && checkpoint.oversampling == (uint8_t)osr
+        && sensor->beginWithCalibration(checkpoint.coefficients, osr);
+
+    if(!restored) {
+        temperature = 0;
+        timestamp = 0;
+        temperatureCounter = 0;
+        return sensor->begin(osr) && sensor->isCalibrationValid();
+    }
+
+    temperature = checkpoint.temperature;
+    timestamp = checkpoint.timestamp;
+    temperatureCounter = checkpoint.temperatureCounter;
+    if(filter != NULL) {
+        filter->setState(checkpoint.filter);
+    }
+    return true;
+}
+
+/**
+ * @brief Takes one sample.
+ *
+ * @param sample Receives the pressure in Pa and temperature in hundredths of a degree.
+ * @param timestamp Sample time from a clock that survives sleep, e.g. an RTC, stored in the sample.
+ * @param compensation Flag to enable second order compensation.
+ * @return A boolean value indicating whether the sensor delivered the raw values.
+ *
+ * This function runs a D1 conversion and, when the temperature refresh is due or no temperature is
+ * known, a D2 conversion. With the default interval of 1 a wake costs exactly one conversion pair.
+ * If a change filter is attached, the sample is not passed through it; call its `update` as usual.
+ */
+bool MS5611Burst::sample(MS5611Sample &sample, uint32_t timestamp, bool compensation) {
+    if(temperatureCounter == 0 || temperature == 0) {
+        temperature = sensor->readRawTemperature();
+        temperatureCounter = temperatureInterval;
+    }
+    temperatureCounter--;
+
+    uint32_t D1 = sensor->readRawPressure();
+    if(D1 == 0 || temperature == 0) {
+        temperatureCounter = 0;
+        return false;
+    }
+
+    sample.timestamp = timestamp;
+    sample.pressure = sensor->compensatePressure(D1, temperature, compensation);
+    sample.temperature = sensor->compensateTemperature(temperature, compensation);
+    this->timestamp = timestamp;
+    return true;
+}
+
+/**
+ * @brief Writes the state needed to resume after sleep.
+ *
+ * @param checkpoint Checkpoint in retained memory that receives the state.
+ */
+void MS5611Burst::sleep(MS5611Checkpoint &checkpoint) {
+    memset(&checkpoint, 0, sizeof(checkpoint));
+    checkpoint.magic = MS5611_CHECKPOINT_MAGIC;
+    for(uint8_t offset = 0; offset < 6; offset++) {
+        checkpoint.coefficients[offset] = sensor->getCalibrationCoefficient(offset);
+    }
+    checkpoint.oversampling = sensor->getOversampling();
+    checkpoint.temperatureCounter = temperatureCounter;
+    checkpoint.temperature = temperature;
+    checkpoint.timestamp = timestamp;
+    if(filter != NULL) {
+        filter->getState(checkpoint.filter);
+    }
+    checkpoint.checksum = getChecksum(checkpoint);
+}
+
+/**
+ * @brief Sets how often a wake also refreshes the temperature.
+ *
+ * @param interval Number of wakes per D2 conversion. 1 refreshes on every wake; larger values make
+ * the remaining wakes cost a single D1 conversion.
+ */
+void MS5611Burst::setTemperatureInterval(uint8_t interval) {
+    temperatureInterval = interval > 0 ? interval : 1;
+    if(temperatureCounter > temperatureInterval) {
+        temperatureCounter = temperatureInterval;
+    }
+}
+
+/**
+ * @brief Retrieves the timestamp of the last sample, including one restored from a checkpoint.
+ *
+ * @return The timestamp passed to the last successful `sample`.
+ */
+uint32_t MS5611Burst::getLastTimestamp(void) {
+    return timestamp;
+}
+
+/**
+ * @brief Checks whether the last wake restored a checkpoint.
+ *
+ * @return False if the last wake performed a full initialization.
+ */
+bool MS5611Burst::isRestored(void) {
+    return restored;
+}
+
+/**
+ * @brief Calculates a Fletcher-16 checksum over the checkpoint, excluding the checksum field.
+ *
+ * @param checkpoint Checkpoint to check.
+ * @return The checksum value.
+ */
+uint16_t MS5611Burst::getChecksum(const MS5611Checkpoint &checkpoint) {
+    const uint8_t *data = (const uint8_t *)&checkpoint;
+    uint16_t first = 0;
+    uint16_t second = 0;
+    for(size_t index = 0; index < offsetof(MS5611Checkpoint, checksum); index++) {
+        first = (first + data[index]) % 255;
+        second = (second + first) % 255;
+    }
+    return (second << 8) | first;
+}
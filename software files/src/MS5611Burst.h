@@ -0,0 +1,42 @@
+#ifndef MS5611Burst_h
+#define MS5611Burst_h
+
+#include "Arduino.h"
+#include "MS5611.h"
+#include "MS5611ChangeFilter.h"
+
+#define MS5611_CHECKPOINT_MAGIC 0x5611
+
+struct MS5611Checkpoint {
+    uint16_t magic;
+    uint16_t coefficients[6];
+    uint8_t oversampling;
+    uint8_t temperatureCounter;
+    uint32_t temperature;
+    uint32_t timestamp;
+    MS5611ChangeFilterState filter;
+    uint16_t checksum;
+};
+
+class MS5611Burst {
+public:
+    MS5611Burst(MS5611 &sensor, MS5611ChangeFilter *filter = NULL);
+    bool wake(const MS5611Checkpoint &checkpoint, MS5611_osr osr = HIGH_RES);
+    bool sample(MS5611Sample &sample, uint32_t timestamp, bool compensation = false);
+    void sleep(MS5611Checkpoint &checkpoint);
+    void setTemperatureInterval(uint8_t interval);
+    uint32_t getLastTimestamp(void);
+    bool isRestored(void);
+private:
+    MS5611 *sensor;
+    MS5611ChangeFilter *filter;
+    uint32_t temperature;
+    uint32_t timestamp;
+    uint8_t temperatureInterval;
+    uint8_t temperatureCounter;
+    bool restored;
+
+    static uint16_t getChecksum(const MS5611Checkpoint &checkpoint);
+};
+
+#endif
@@ -0,0 +1,129 @@
+#ifndef MS5611CalibrationRegistry_h
+#define MS5611CalibrationRegistry_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include "MS5611Compensation.h"
+
+struct MS5611CalibrationContext {
+    uint16_t coefficients[6];
+    int64_t offset;
+    int64_t sensitivity;
+    uint32_t referenceTemperature;
+};
+
+/**
+ * Registry of calibration sets for tools that process data of many units, e.g. raw logs whose headers
+ * carry the PROM of the logging sensor.
+ *
+ * Each distinct coefficient set is stored once in a fixed table of N entries with open addressing, keyed
+ * by a hash of C1..C6, so lookups cost O(1) on average and no memory is allocated. Entries hold a context
+ * with the coefficient-only terms of the compensation precomputed, and `temperature` and `pressure` on a
+ * context give exactly the results of MS5611Compensation<Policy>. `insertProm` takes all eight PROM words
+ * and checks them with the CRC-4 layout of the part, `Policy::checkProm`. Like the compensation, this
+ * header has no Arduino dependency and builds on the host as well as on the device.
+ */
+template <class Policy, uint16_t N>
+class MS5611CalibrationRegistry {
+public:
+    MS5611CalibrationRegistry() {
+        clear();
+    }
+
+    void clear(void) {
+        for(uint16_t index = 0; index < N; index++) {
+            used[index] = false;
+        }
+        count = 0;
+    }
+
+    static uint32_t hash(const uint16_t coefficients[6]) {
+        uint32_t value = 2166136261UL;
+        for(uint8_t index = 0; index < 6; index++) {
+            value = (value ^ (coefficients[index] & 0xFF)) * 16777619UL;
+            value = (value ^ (coefficients[index] >> 8)) * 16777619UL;
+        }
+        return value;
+    }
+
+    const MS5611CalibrationContext *find(const uint16_t coefficients[6]) const {
+        uint16_t index = (uint16_t)(hash(coefficients) % N);
+        for(uint16_t probe = 0; probe < N && used[index]; probe++) {
+            if(matches(entries[index], coefficients)) {
+                return &entries[index];
+            }
+            index = (index + 1) % N;
+        }
+        return NULL;
+    }
+
+    const MS5611CalibrationContext *insert(const uint16_t coefficients[6]) {
+        uint16_t index = (uint16_t)(hash(coefficients) % N);
+        for(uint16_t probe = 0; probe < N; probe++) {
+            if(!used[index]) {
+                prepare(entries[index], coefficients);
+                used[index] = true;
+                count++;
+                return &entries[index];
+            }
+            if(matches(entries[index], coefficients)) {
+                return &entries[index];
+            }
+            index = (index + 1) % N;
+        }
+        return NULL;
+    }
+
+    const MS5611CalibrationContext *insertProm(const uint16_t prom[8]) {
+        if(!Policy::checkProm(prom)) {
+            return NULL;
+        }
+        return insert(prom + 1);
+    }
+
+    uint16_t getCount(void) const {
+        return count;
+    }
+
+    static int32_t temperature(const MS5611CalibrationContext &context, uint32_t D2, bool compensation = false) {
+        int32_t dT = (int32_t)(D2 - context.referenceTemperature);
+        int32_t firstOrder = MS5611Compensation<Policy>::getFirstOrderTemperature(context.coefficients, dT);
+        return firstOrder - (MS5611_SECOND_ORDER && compensation ? Policy::getTemperature2(firstOrder, dT) : 0);
+    }
+
+    static int32_t pressure(const MS5611CalibrationContext &context, uint32_t D1, uint32_t D2, bool compensation = false) {
+        int32_t dT = (int32_t)(D2 - context.referenceTemperature);
+        int64_t offset = context.offset + (int64_t)context.coefficients[3] * dT / (1LL << Policy::offsetTemperatureShift);
+        int64_t sensitivity = context.sensitivity + (int64_t)context.coefficients[2] * dT / (1LL << Policy::sensitivityTemperatureShift);
+        if(MS5611_SECOND_ORDER && compensation) {
+            int32_t firstOrder = MS5611Compensation<Policy>::getFirstOrderTemperature(context.coefficients, dT);
+            offset -= Policy::getOffset2(firstOrder);
+            sensitivity -= Policy::getSensitivity2(firstOrder);
+        }
+        return MS5611Compensation<Policy>::getPressure(D1, offset, sensitivity);
+    }
+private:
+    MS5611CalibrationContext entries[N];
+    bool used[N];
+    uint16_t count;
+
+    static bool matches(const MS5611CalibrationContext &entry, const uint16_t coefficients[6]) {
+        for(uint8_t index = 0; index < 6; index++) {
+            if(entry.coefficients[index] != coefficients[index]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static void prepare(MS5611CalibrationContext &entry, const uint16_t coefficients[6]) {
+        for(uint8_t index = 0; index < 6; index++) {
+            entry.coefficients[index] = coefficients[index];
+        }
+        entry.offset = (int64_t)coefficients[1] << Policy::offsetShift;
+        entry.sensitivity = (int64_t)coefficients[0] << Policy::sensitivityShift;
+        entry.referenceTemperature = (uint32_t)coefficients[4] * 256;
+    }
+};
+
+#endif
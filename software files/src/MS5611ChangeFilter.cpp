@@ -0,0 +1,136 @@
+#include "MS5611ChangeFilter.h"
+
+MS5611ChangeFilter::MS5611ChangeFilter() {
+    begin();
+}
+
+/**
+ * @brief Configures the reporting thresholds.
+ *
+ * @param pressureThreshold Filtered pressure change in Pa that triggers a report.
+ * @param temperatureThreshold Filtered temperature change in hundredths of a degree that triggers a report.
+ * @param heartbeat Maximum time between reports in milliseconds, 0 to disable.
+ * @param smoothing Exponential filter strength; each sample moves the filter by 1/2^smoothing.
+ *
+ * This function also resets the filter, so the next sample is always reported.
+ */
+void MS5611ChangeFilter::begin(int32_t pressureThreshold, int32_t temperatureThreshold, uint32_t heartbeat, uint8_t smoothing) {
+    this->pressureThreshold = pressureThreshold;
+    this->temperatureThreshold = temperatureThreshold;
+    this->heartbeat = heartbeat;
+    this->smoothing = smoothing < 16 ? smoothing : 15;
+    reset();
+}
+
+/**
+ * @brief Clears the filter and the last reported values.
+ */
+void MS5611ChangeFilter::reset(void) {
+    primed = false;
+    filteredPressure = 0;
+    filteredTemperature = 0;
+    reportedPressure = 0;
+    reportedTemperature = 0;
+    reportedTime = 0;
+}
+
+/**
+ * @brief Feeds a sample and decides whether it should be reported.
+ *
+ * @param sample Sample with timestamp in milliseconds, pressure in Pa and temperature in hundredths of a degree.
+ * @return True if the sample should be passed on downstream.
+ *
+ * This function smooths pressure and temperature with an exponential filter held in Q8 fixed point,
+ * then compares the filtered values with the last reported ones. A report is due when either moved by
+ * at least its threshold or when the heartbeat time has elapsed since the last report.
+ */
+bool MS5611ChangeFilter::update(const MS5611Sample &sample) {
+    if(!primed) {
+        filteredPressure = sample.pressure * 256;
+        filteredTemperature = sample.temperature * 256;
+    } else {
+        filteredPressure += (sample.pressure * 256 - filteredPressure) / ((int32_t)1 << smoothing);
+        filteredTemperature += (sample.temperature * 256 - filteredTemperature) / ((int32_t)1 << smoothing);
+    }
+
+    int32_t pressure = getPressure();
+    int32_t temperature = getTemperature();
+    int32_t pressureChange = pressure - reportedPressure;
+    int32_t temperatureChange = temperature - reportedTemperature;
+
+    bool report = !primed
+        || pressureChange >= pressureThreshold || pressureChange <= -pressureThreshold
+        || temperatureChange >= temperatureThreshold || temperatureChange <= -temperatureThreshold
+        || (heartbeat > 0 && (uint32_t)(sample.timestamp - reportedTime) >= heartbeat);
+
+    if(report) {
+        primed = true;
+        reportedPressure = pressure;
+        reportedTemperature = temperature;
+        reportedTime = sample.timestamp;
+    }
+    return report;
+}
+
+/**
+ * @brief Feeds a sample and retrieves the filtered values when a report is due.
+ *
+ * @param sample Sample with timestamp in milliseconds, pressure in Pa and temperature in hundredths of a degree.
+ * @param output Receives the sample timestamp with the filtered pressure and temperature if a report is due.
+ * @return True if `output` was written and should be passed on downstream.
+ */
+bool MS5611ChangeFilter::update(const MS5611Sample &sample, MS5611Sample &output) {
+    if(!update(sample)) {
+        return false;
+    }
+    output.timestamp = sample.timestamp;
+    output.pressure = reportedPressure;
+    output.temperature = reportedTemperature;
+    return true;
+}
+
+/**
+ * @brief Retrieves the filtered pressure.
+ *
+ * @return The pressure in Pa.
+ */
+int32_t MS5611ChangeFilter::getPressure(void) {
+    return filteredPressure / 256;
+}
+
+/**
+ * @brief Retrieves the filtered temperature.
+ *
+ * @return The temperature in hundredths of a degree Celsius.
+ */
+int32_t MS5611ChangeFilter::getTemperature(void) {
+    return filteredTemperature / 256;
+}
+
+/**
+ * @brief Copies the filter state, e.g. into memory retained during deep sleep.
+ *
+ * @param state Receives the filter and last report state.
+ */
+void MS5611ChangeFilter::getState(MS5611ChangeFilterState &state) {
+    state.filteredPressure = filteredPressure;
+    state.filteredTemperature = filteredTemperature;
+    state.reportedPressure = reportedPressure;
+    state.reportedTemperature = reportedTemperature;
+    state.reportedTime = reportedTime;
+    state.primed = primed;
+}
+
+/**
+ * @brief Restores a filter state saved with `getState`.
+ *
+ * @param state Filter and last report state. Thresholds and smoothing are not part of the state.
+ */
+void MS5611ChangeFilter::setState(const MS5611ChangeFilterState &state) {
+    filteredPressure = state.filteredPressure;
+    filteredTemperature = state.filteredTemperature;
+    reportedPressure = state.reportedPressure;
+    reportedTemperature = state.reportedTemperature;
+    reportedTime = state.reportedTime;
+    primed = state.primed;
+}
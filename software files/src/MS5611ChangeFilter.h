@@ -0,0 +1,45 @@
+#ifndef MS5611ChangeFilter_h
+#define MS5611ChangeFilter_h
+
+#include "Arduino.h"
+#include "MS5611.h"
+
+#define MS5611_CHANGE_PRESSURE_THRESHOLD 10
+#define MS5611_CHANGE_TEMPERATURE_THRESHOLD 10
+#define MS5611_CHANGE_HEARTBEAT 60000
+#define MS5611_CHANGE_SMOOTHING 2
+
+struct MS5611ChangeFilterState {
+    int32_t filteredPressure;
+    int32_t filteredTemperature;
+    int32_t reportedPressure;
+    int32_t reportedTemperature;
+    uint32_t reportedTime;
+    bool primed;
+};
+
+class MS5611ChangeFilter {
+public:
+    MS5611ChangeFilter();
+    void begin(int32_t pressureThreshold = MS5611_CHANGE_PRESSURE_THRESHOLD, int32_t temperatureThreshold = MS5611_CHANGE_TEMPERATURE_THRESHOLD, uint32_t heartbeat = MS5611_CHANGE_HEARTBEAT, uint8_t smoothing = MS5611_CHANGE_SMOOTHING);
+    void reset(void);
+    bool update(const MS5611Sample &sample);
+    bool update(const MS5611Sample &sample, MS5611Sample &output);
+    int32_t getPressure(void);
+    int32_t getTemperature(void);
+    void getState(MS5611ChangeFilterState &state);
+    void setState(const MS5611ChangeFilterState &state);
+private:
+    int32_t pressureThreshold;
+    int32_t temperatureThreshold;
+    uint32_t heartbeat;
+    uint8_t smoothing;
+    bool primed;
+    int32_t filteredPressure;
+    int32_t filteredTemperature;
+    int32_t reportedPressure;
+    int32_t reportedTemperature;
+    uint32_t reportedTime;
+};
+
+#endif
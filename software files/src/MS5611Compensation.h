@@ -0,0 +1,193 @@
+#ifndef MS5611Compensation_h
+#define MS5611Compensation_h
+
+#include <stdint.h>
+
+#ifdef MS5611_NO_SECOND_ORDER
+#define MS5611_SECOND_ORDER false
+#else
+#define MS5611_SECOND_ORDER true
+#endif
+
+/**
+ * Compensation policies for the MS56xx sensor family.
+ *
+ * All parts share the first order scheme dT = D2 - C5 * 2^8, TEMP = 2000 + dT * C6 / 2^23,
+ * OFF = C2 * 2^a + C4 * dT / 2^b, SENS = C1 * 2^c + C3 * dT / 2^d and P = (D1 * SENS / 2^21 - OFF) / 2^15,
+ * and differ in the shift amounts and the second order corrections. A policy provides both, so the
+ * compensation template below is specialized per part at compile time. Temperatures are in hundredths
+ * of a degree Celsius and pressures in Pa.
+ *
+ * Every compensation function is a C++11 constexpr, so results for constant coefficients and raw values,
+ * e.g. the datasheet examples or a fixed calibration held in a constexpr array, are computed at compile
+ * time. A policy also knows where its part keeps the CRC-4 of the PROM: `getCrc` computes it over the
+ * eight PROM words as read and `checkProm` compares it with the stored one. The MS5611, MS5607 and MS5803
+ * store it in the low nibble of word 7; the MS5637 in the high nibble of word 0, over seven words.
+ */
+struct MS5611PolicyBase {
+    static constexpr int64_t square(int32_t value) {
+        return (int64_t)value * value;
+    }
+
+    static uint8_t crc4(const uint16_t prom[8], uint16_t firstMask, uint16_t lastMask) {
+        uint16_t remainder = 0;
+        for(uint8_t index = 0; index < 16; index++) {
+            uint16_t word = prom[index / 2] & (index < 2 ? firstMask : (index >= 14 ? lastMask : 0xFFFF));
+            remainder ^= index % 2 == 1 ? word & 0x00FF : word >> 8;
+            for(uint8_t bit = 0; bit < 8; bit++) {
+                remainder = remainder & 0x8000 ? (remainder << 1) ^ 0x3000 : remainder << 1;
+            }
+        }
+        return (remainder >> 12) & 0x0F;
+    }
+
+    static uint8_t getCrc(const uint16_t prom[8]) {
+        return crc4(prom, 0xFFFF, 0xFF00);
+    }
+
+    static bool checkProm(const uint16_t prom[8]) {
+        return getCrc(prom) == (prom[7] & 0x0F);
+    }
+};
+
+struct MS5611Policy : MS5611PolicyBase {
+    static const uint8_t address = 0x77;
+    static const uint8_t offsetShift = 16;
+    static const uint8_t offsetTemperatureShift = 7;
+    static const uint8_t sensitivityShift = 15;
+    static const uint8_t sensitivityTemperatureShift = 8;
+
+    static constexpr int32_t getTemperature2(int32_t temperature, int32_t dT) {
+        return temperature < 2000 ? (int32_t)(square(dT) / 2147483648LL) : 0;
+    }
+
+    static constexpr int64_t getOffset2(int32_t temperature) {
+        return (temperature < 2000 ? 5 * square(temperature - 2000) / 2 : 0)
+            + (temperature < -1500 ? 7 * square(temperature + 1500) : 0);
+    }
+
+    static constexpr int64_t getSensitivity2(int32_t temperature) {
+        return (temperature < 2000 ? 5 * square(temperature - 2000) / 4 : 0)
+            + (temperature < -1500 ? 11 * square(temperature + 1500) / 2 : 0);
+    }
+};
+
+struct MS5607Policy : MS5611PolicyBase {
+    static const uint8_t address = 0x77;
+    static const uint8_t offsetShift = 17;
+    static const uint8_t offsetTemperatureShift = 6;
+    static const uint8_t sensitivityShift = 16;
+    static const uint8_t sensitivityTemperatureShift = 7;
+
+    static constexpr int32_t getTemperature2(int32_t temperature, int32_t dT) {
+        return temperature < 2000 ? (int32_t)(square(dT) / 2147483648LL) : 0;
+    }
+
+    static constexpr int64_t getOffset2(int32_t temperature) {
+        return (temperature < 2000 ? 61 * square(temperature - 2000) / 16 : 0)
+            + (temperature < -1500 ? 15 * square(temperature + 1500) : 0);
+    }
+
+    static constexpr int64_t getSensitivity2(int32_t temperature) {
+        return (temperature < 2000 ? 2 * square(temperature - 2000) : 0)
+            + (temperature < -1500 ? 8 * square(temperature + 1500) : 0);
+    }
+};
+
+struct MS5637Policy : MS5611PolicyBase {
+    static const uint8_t address = 0x76;
+    static const uint8_t offsetShift = 17;
+    static const uint8_t offsetTemperatureShift = 6;
+    static const uint8_t sensitivityShift = 16;
+    static const uint8_t sensitivityTemperatureShift = 7;
+
+    static uint8_t getCrc(const uint16_t prom[8]) {
+        return crc4(prom, 0x0FFF, 0x0000);
+    }
+
+    static bool checkProm(const uint16_t prom[8]) {
+        return getCrc(prom) == (prom[0] >> 12);
+    }
+
+    static constexpr int32_t getTemperature2(int32_t temperature, int32_t dT) {
+        return temperature < 2000
+            ? (int32_t)(3 * square(dT) / 8589934592LL)
+            : (int32_t)(5 * square(dT) / 274877906944LL);
+    }
+
+    static constexpr int64_t getOffset2(int32_t temperature) {
+        return (temperature < 2000 ? 61 * square(temperature - 2000) / 16 : 0)
+            + (temperature < -1500 ? 17 * square(temperature + 1500) : 0);
+    }
+
+    static constexpr int64_t getSensitivity2(int32_t temperature) {
+        return (temperature < 2000 ? 29 * square(temperature - 2000) / 16 : 0)
+            + (temperature < -1500 ? 9 * square(temperature + 1500) : 0);
+    }
+};
+
+/**
+ * MS5803-01BA. Other MS5803 pressure ranges use different shifts and need their own policy.
+ */
+struct MS5803Policy : MS5611PolicyBase {
+    static const uint8_t address = 0x77;
+    static const uint8_t offsetShift = 16;
+    static const uint8_t offsetTemperatureShift = 7;
+    static const uint8_t sensitivityShift = 15;
+    static const uint8_t sensitivityTemperatureShift = 8;
+
+    static constexpr int32_t getTemperature2(int32_t temperature, int32_t dT) {
+        return temperature < 2000 ? (int32_t)(square(dT) / 2147483648LL) : 0;
+    }
+
+    static constexpr int64_t getOffset2(int32_t temperature) {
+        return temperature < 2000 ? 3 * square(temperature - 2000) : 0;
+    }
+
+    static constexpr int64_t getSensitivity2(int32_t temperature) {
+        return (temperature < 2000 ? 7 * square(temperature - 2000) / 8 : 0)
+            + (temperature < -1500 ? 2 * square(temperature + 1500) : 0)
+            - (temperature >= 4500 ? square(temperature - 4500) / 8 : 0);
+    }
+};
+
+template <class Policy>
+class MS5611Compensation {
+public:
+    static constexpr int32_t getDeltaTemperature(const uint16_t *coefficients, uint32_t D2) {
+        return (int32_t)(D2 - (uint32_t)coefficients[4] * 256);
+    }
+
+    static constexpr int32_t getFirstOrderTemperature(const uint16_t *coefficients, int32_t dT) {
+        return 2000 + (int32_t)(((int64_t)dT * coefficients[5]) / 8388608);
+    }
+
+    static constexpr int64_t getOffset(const uint16_t *coefficients, int32_t dT, bool compensation) {
+        return ((int64_t)coefficients[1] << Policy::offsetShift)
+            + (int64_t)coefficients[3] * dT / (1LL << Policy::offsetTemperatureShift)
+            - (MS5611_SECOND_ORDER && compensation ? Policy::getOffset2(getFirstOrderTemperature(coefficients, dT)) : 0);
+    }
+
+    static constexpr int64_t getSensitivity(const uint16_t *coefficients, int32_t dT, bool compensation) {
+        return ((int64_t)coefficients[0] << Policy::sensitivityShift)
+            + (int64_t)coefficients[2] * dT / (1LL << Policy::sensitivityTemperatureShift)
+            - (MS5611_SECOND_ORDER && compensation ? Policy::getSensitivity2(getFirstOrderTemperature(coefficients, dT)) : 0);
+    }
+
+    static constexpr int32_t getPressure(uint32_t D1, int64_t offset, int64_t sensitivity) {
+        return (int32_t)(((int64_t)D1 * sensitivity / 2097152 - offset) / 32768);
+    }
+
+    static constexpr int32_t temperature(const uint16_t *coefficients, uint32_t D2, bool compensation) {
+        return getFirstOrderTemperature(coefficients, getDeltaTemperature(coefficients, D2))
+            - (MS5611_SECOND_ORDER && compensation ? Policy::getTemperature2(getFirstOrderTemperature(coefficients, getDeltaTemperature(coefficients, D2)),
+                getDeltaTemperature(coefficients, D2)) : 0);
+    }
+
+    static constexpr int32_t pressure(const uint16_t *coefficients, uint32_t D1, uint32_t D2, bool compensation) {
+        return getPressure(D1, getOffset(coefficients, getDeltaTemperature(coefficients, D2), compensation),
+            getSensitivity(coefficients, getDeltaTemperature(coefficients, D2), compensation));
+    }
+};
+
+#endif
@@ -0,0 +1,115 @@
+#include "MS5611Differential.h"
+
+/**
+ * @brief Creates a differential pair from two MS5611 sensors.
+ *
+ * @param first Sensor on the positive side of the difference.
+ * @param second Sensor on the negative side of the difference.
+ *
+ * Both sensors must be initialized and either use different addresses on one bus or sit on separate buses.
+ */
+MS5611Differential::MS5611Differential(MS5611 &first, MS5611 &second) {
+    this->first = &first;
+    this->second = &second;
+    firstTemperature = 0;
+    secondTemperature = 0;
+    firstPressure = 0;
+    secondPressure = 0;
+    temperatureInterval = MS5611_DIFFERENTIAL_TEMPERATURE_INTERVAL;
+    temperatureCounter = 0;
+}
+
+/**
+ * @brief Sets how often the temperature of both sensors is refreshed.
+ *
+ * @param interval Number of pressure readings per temperature refresh. 1 refreshes on every reading.
+ *
+ * Temperature changes slowly compared to pressure, so reusing the last D2 value lets the pair deliver
+ * pressure differences at close to the full D1 conversion rate.
+ */
+void MS5611Differential::setTemperatureInterval(uint8_t interval) {
+    temperatureInterval = interval > 0 ? interval : 1;
+    temperatureCounter = 0;
+}
+
+/**
+ * @brief Reads a time-aligned pressure difference.
+ *
+ * @param difference Receives the pressure of the first sensor minus the second in Pa.
+ * @param compensation Flag to enable second order pressure compensation.
+ * @return A boolean value indicating whether both sensors delivered a reading.
+ *
+ * This function starts D1 conversions on both sensors back-to-back, waits once for the conversion and reads
+ * both results, so the two pressure samples are taken only one bus transaction apart. When the temperature
+ * refresh is due, or no temperature is known yet, D2 conversions are taken the same way first.
+ */
+bool MS5611Differential::read(int32_t &difference, bool compensation) {
+    uint8_t conversionTime = getConversionTime();
+
+    if(temperatureCounter == 0 || firstTemperature == 0 || secondTemperature == 0) {
+        first->startTemperatureConversion();
+        second->startTemperatureConversion();
+        delay(conversionTime);
+        firstTemperature = first->readConversion();
+        secondTemperature = second->readConversion();
+        temperatureCounter = temperatureInterval;
+    }
+    temperatureCounter--;
+
+    first->startPressureConversion();
+    second->startPressureConversion();
+    delay(conversionTime);
+    uint32_t firstRaw = first->readConversion();
+    uint32_t secondRaw = second->readConversion();
+
+    if(firstRaw == 0 || secondRaw == 0 || firstTemperature == 0 || secondTemperature == 0) {
+        temperatureCounter = 0;
+        return false;
+    }
+
+    firstPressure = first->compensatePressure(firstRaw, firstTemperature, compensation);
+    secondPressure = second->compensatePressure(secondRaw, secondTemperature, compensation);
+    difference = firstPressure - secondPressure;
+    return true;
+}
+
+/**
+ * @brief Reads a time-aligned pressure difference.
+ *
+ * @param compensation Flag to enable second order pressure compensation.
+ * @return The pressure of the first sensor minus the second in Pa, or 0 if a sensor did not answer.
+ */
+int32_t MS5611Differential::readDifference(bool compensation) {
+    int32_t difference = 0;
+    read(difference, compensation);
+    return difference;
+}
+
+/**
+ * @brief Retrieves the pressure of the first sensor from the last reading.
+ *
+ * @return The pressure in Pa.
+ */
+int32_t MS5611Differential::getFirstPressure(void) {
+    return firstPressure;
+}
+
+/**
+ * @brief Retrieves the pressure of the second sensor from the last reading.
+ *
+ * @return The pressure in Pa.
+ */
+int32_t MS5611Differential::getSecondPressure(void) {
+    return secondPressure;
+}
+
+/**
+ * @brief Retrieves the longer conversion time of the two sensors.
+ *
+ * @return The conversion time in milliseconds.
+ */
+uint8_t MS5611Differential::getConversionTime(void) {
+    uint8_t firstTime = first->getConversionTime();
+    uint8_t secondTime = second->getConversionTime();
+    return firstTime > secondTime ? firstTime : secondTime;
+}
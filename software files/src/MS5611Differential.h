@@ -0,0 +1,30 @@
+#ifndef MS5611Differential_h
+#define MS5611Differential_h
+
+#include "Arduino.h"
+#include "MS5611.h"
+
+#define MS5611_DIFFERENTIAL_TEMPERATURE_INTERVAL 10
+
+class MS5611Differential {
+public:
+    MS5611Differential(MS5611 &first, MS5611 &second);
+    void setTemperatureInterval(uint8_t interval);
+    bool read(int32_t &difference, bool compensation = false);
+    int32_t readDifference(bool compensation = false);
+    int32_t getFirstPressure(void);
+    int32_t getSecondPressure(void);
+private:
+    MS5611 *first;
+    MS5611 *second;
+    uint32_t firstTemperature;
+    uint32_t secondTemperature;
+    int32_t firstPressure;
+    int32_t secondPressure;
+    uint8_t temperatureInterval;
+    uint8_t temperatureCounter;
+
+    uint8_t getConversionTime(void);
+};
+
+#endif
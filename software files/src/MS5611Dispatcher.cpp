@@ -0,0 +1,85 @@
+#include "MS5611Dispatcher.h"
+
+MS5611Dispatcher::MS5611Dispatcher() {
+    for(uint8_t index = 0; index < MS5611_DISPATCHER_MAX_SUBSCRIBERS; index++) {
+        subscribers[index].callback = NULL;
+    }
+}
+
+/**
+ * @brief Registers a consumer for published samples.
+ *
+ * @param callback Function called with each delivered sample. It receives a reference to the publisher's
+ * sample, which is only valid during the call.
+ * @param context Pointer passed back to the callback unchanged, e.g. the consuming object.
+ * @param decimation Deliver only every n-th published sample. 1 delivers all of them.
+ * @return A handle for `unsubscribe`, or -1 if the subscriber table is full.
+ */
+int8_t MS5611Dispatcher::subscribe(MS5611Callback callback, void *context, uint8_t decimation) {
+    if(callback == NULL) {
+        return -1;
+    }
+    for(uint8_t index = 0; index < MS5611_DISPATCHER_MAX_SUBSCRIBERS; index++) {
+        if(subscribers[index].callback == NULL) {
+            subscribers[index].callback = callback;
+            subscribers[index].context = context;
+            subscribers[index].decimation = decimation > 0 ? decimation : 1;
+            subscribers[index].counter = 0;
+            return index;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Removes a consumer.
+ *
+ * @param handle Handle returned by `subscribe`.
+ * @return False if the handle does not refer to a registered consumer.
+ */
+bool MS5611Dispatcher::unsubscribe(int8_t handle) {
+    if(handle < 0 || handle >= MS5611_DISPATCHER_MAX_SUBSCRIBERS || subscribers[handle].callback == NULL) {
+        return false;
+    }
+    subscribers[handle].callback = NULL;
+    return true;
+}
+
+/**
+ * @brief Delivers a sample to every consumer that is due.
+ *
+ * @param sample Sample to deliver. It is passed by reference, never copied.
+ *
+ * Consumers are called in the order of their table slots. Each consumer's decimation counter is advanced
+ * on every publish, so a consumer with decimation 4 receives the 1st, 5th, 9th... sample after subscribing.
+ */
+void MS5611Dispatcher::publish(const MS5611Sample &sample) {
+    for(uint8_t index = 0; index < MS5611_DISPATCHER_MAX_SUBSCRIBERS; index++) {
+        Subscriber &subscriber = subscribers[index];
+        if(subscriber.callback == NULL) {
+            continue;
+        }
+        if(subscriber.counter == 0) {
+            subscriber.callback(sample, subscriber.context);
+        }
+        subscriber.counter++;
+        if(subscriber.counter >= subscriber.decimation) {
+            subscriber.counter = 0;
+        }
+    }
+}
+
+/**
+ * @brief Retrieves the number of registered consumers.
+ *
+ * @return The subscriber count.
+ */
+uint8_t MS5611Dispatcher::getSubscriberCount(void) {
+    uint8_t count = 0;
+    for(uint8_t index = 0; index < MS5611_DISPATCHER_MAX_SUBSCRIBERS; index++) {
+        if(subscribers[index].callback != NULL) {
+            count++;
+        }
+    }
+    return count;
+}
@@ -0,0 +1,31 @@
+#ifndef MS5611Dispatcher_h
+#define MS5611Dispatcher_h
+
+#include "Arduino.h"
+#include "MS5611.h"
+
+#ifndef MS5611_DISPATCHER_MAX_SUBSCRIBERS
+#define MS5611_DISPATCHER_MAX_SUBSCRIBERS 8
+#endif
+
+typedef void (*MS5611Callback)(const MS5611Sample &sample, void *context);
+
+class MS5611Dispatcher {
+public:
+    MS5611Dispatcher();
+    int8_t subscribe(MS5611Callback callback, void *context = NULL, uint8_t decimation = 1);
+    bool unsubscribe(int8_t handle);
+    void publish(const MS5611Sample &sample);
+    uint8_t getSubscriberCount(void);
+private:
+    struct Subscriber {
+        MS5611Callback callback;
+        void *context;
+        uint8_t decimation;
+        uint8_t counter;
+    };
+
+    Subscriber subscribers[MS5611_DISPATCHER_MAX_SUBSCRIBERS];
+};
+
+#endif
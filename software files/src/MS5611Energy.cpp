@@ -0,0 +1,75 @@
+#include "MS5611Energy.h"
+
+/**
+ * @brief Chooses sampling settings that fit a daily charge budget.
+ *
+ * @param plan Receives the chosen oversampling rate, temperature interval, sampling interval, charge per
+ * sample and the predicted consumption.
+ * @param budget Charge budget for the sensor in µAh per day.
+ * @param resolution Required RMS pressure resolution in hundredths of a Pa.
+ * @param temperatureAge Maximum age of the temperature used for compensation in milliseconds.
+ * @param busClock I2C clock in Hz.
+ * @param pullupCurrent Current through the I2C pull-ups while a line is low in µA.
+ * @return False if no oversampling rate reaches the resolution or the budget does not even cover standby.
+ *
+ * This function selects the cheapest oversampling rate that meets the resolution, since a finer rate
+ * never pays for itself when samples can be averaged later. It then spends the budget left after standby
+ * current on the shortest sampling interval it allows, and stretches the temperature refresh to as many
+ * samples as fit within `temperatureAge`, which in turn shortens the interval. The interval never drops
+ * below the time the conversions themselves take.
+ */
+bool MS5611Energy::plan(MS5611EnergyPlan &plan, uint32_t budget, uint32_t resolution, uint32_t temperatureAge, uint32_t busClock, uint32_t pullupCurrent) {
+    const MS5611_osr rates[] = { ULTRA_LOW_POWER, LOW_POWER, STANDARD, HIGH_RES, ULTRA_HIGH_RES };
+    bool found = false;
+    MS5611_osr osr = ULTRA_HIGH_RES;
+    for(uint8_t index = 0; index < 5 && !found; index++) {
+        if(getResolution(rates[index]) <= resolution) {
+            osr = rates[index];
+            found = true;
+        }
+    }
+    if(!found) {
+        return false;
+    }
+
+    uint64_t budgetCharge = (uint64_t)budget * MS5611_ENERGY_MICROAMPERE_HOUR;
+    uint64_t standbyCharge = MS5611_ENERGY_DAY / 1000 * MS5611_ENERGY_STANDBY_CURRENT;
+    if(budgetCharge <= standbyCharge) {
+        return false;
+    }
+    uint64_t dailyCharge = budgetCharge - standbyCharge;
+
+    uint8_t temperatureInterval = 1;
+    uint32_t conversionTime = MS5611Planner::getConversionTime(osr) / 1000;
+    uint32_t interval = getInterval(getSampleCharge(osr, temperatureInterval, busClock, pullupCurrent), dailyCharge, 2 * conversionTime);
+
+    for(uint8_t iteration = 0; iteration < 2; iteration++) {
+        uint32_t samples = temperatureAge / interval;
+        temperatureInterval = samples < 1 ? 1 : (samples > 255 ? 255 : samples);
+        uint32_t minimumInterval = conversionTime + (conversionTime + temperatureInterval - 1) / temperatureInterval;
+        interval = getInterval(getSampleCharge(osr, temperatureInterval, busClock, pullupCurrent), dailyCharge, minimumInterval);
+    }
+
+    plan.osr = osr;
+    plan.temperatureInterval = temperatureInterval;
+    plan.interval = interval;
+    plan.sampleCharge = getSampleCharge(osr, temperatureInterval, busClock, pullupCurrent);
+    plan.consumption = getConsumption(plan.sampleCharge, interval);
+    return true;
+}
+
+/**
+ * @brief Calculates the shortest sampling interval a daily charge allows.
+ *
+ * @param sampleCharge Charge per sample in nC.
+ * @param dailyCharge Charge available for sampling per day in nC.
+ * @param minimumInterval Lower bound of the interval in milliseconds.
+ * @return The sampling interval in milliseconds, rounded up so the budget is not exceeded.
+ */
+uint32_t MS5611Energy::getInterval(uint32_t sampleCharge, uint64_t dailyCharge, uint32_t minimumInterval) {
+    uint64_t interval = (MS5611_ENERGY_DAY * sampleCharge + dailyCharge - 1) / dailyCharge;
+    if(interval < minimumInterval) {
+        interval = minimumInterval;
+    }
+    return interval > 0xFFFFFFFFULL ? 0xFFFFFFFFUL : (uint32_t)interval;
+}
@@ -0,0 +1,67 @@
+#ifndef MS5611Energy_h
+#define MS5611Energy_h
+
+#include "Arduino.h"
+#include "MS5611.h"
+#include "MS5611Planner.h"
+
+#define MS5611_ENERGY_STANDBY_CURRENT 20
+#define MS5611_ENERGY_PULLUP_CURRENT 700
+#define MS5611_ENERGY_BUS_CLOCK 400000
+#define MS5611_ENERGY_TEMPERATURE_AGE 60000
+#define MS5611_ENERGY_DAY 86400000ULL
+#define MS5611_ENERGY_MICROAMPERE_HOUR 3600000ULL
+
+struct MS5611EnergyPlan {
+    MS5611_osr osr;
+    uint8_t temperatureInterval;
+    uint32_t interval;
+    uint32_t sampleCharge;
+    uint32_t consumption;
+};
+
+/**
+ * Energy model of the MS5611 per oversampling rate.
+ *
+ * Conversion charge follows the datasheet supply current at one conversion per second, so 12.5 µA at
+ * OSR 4096 becomes 12500 nC per conversion. Bus charge assumes the pull-ups conduct half of the bit
+ * time of every bit of a conversion transaction. Resolutions are the datasheet RMS pressure noise in
+ * hundredths of a Pa. Charges are in nC, consumption in nAh per day and intervals in milliseconds.
+ */
+class MS5611Energy {
+public:
+    static constexpr uint32_t getConversionCharge(MS5611_osr osr) {
+        return osr == ULTRA_HIGH_RES ? 12500UL :
+               osr == HIGH_RES ? 6300UL :
+               osr == STANDARD ? 3200UL :
+               osr == LOW_POWER ? 1700UL : 900UL;
+    }
+
+    static constexpr uint32_t getResolution(MS5611_osr osr) {
+        return osr == ULTRA_HIGH_RES ? 120UL :
+               osr == HIGH_RES ? 180UL :
+               osr == STANDARD ? 270UL :
+               osr == LOW_POWER ? 420UL : 650UL;
+    }
+
+    static constexpr uint32_t getBusCharge(uint32_t busClock = MS5611_ENERGY_BUS_CLOCK, uint32_t pullupCurrent = MS5611_ENERGY_PULLUP_CURRENT) {
+        return (uint32_t)((uint64_t)(MS5611_PLANNER_START_BITS + MS5611_PLANNER_READ_BITS) * pullupCurrent * 1000 / (2ULL * busClock));
+    }
+
+    static constexpr uint32_t getSampleCharge(MS5611_osr osr, uint8_t temperatureInterval, uint32_t busClock = MS5611_ENERGY_BUS_CLOCK, uint32_t pullupCurrent = MS5611_ENERGY_PULLUP_CURRENT) {
+        return getConversionCharge(osr) + getBusCharge(busClock, pullupCurrent)
+            + (getConversionCharge(osr) + getBusCharge(busClock, pullupCurrent)) / (temperatureInterval > 0 ? temperatureInterval : 1);
+    }
+
+    static constexpr uint32_t getConsumption(uint32_t sampleCharge, uint32_t interval, uint32_t standbyCurrent = MS5611_ENERGY_STANDBY_CURRENT) {
+        return (uint32_t)((MS5611_ENERGY_DAY / (interval > 0 ? interval : 1) * sampleCharge + MS5611_ENERGY_DAY / 1000 * standbyCurrent)
+            * 1000 / MS5611_ENERGY_MICROAMPERE_HOUR);
+    }
+
+    static bool plan(MS5611EnergyPlan &plan, uint32_t budget, uint32_t resolution, uint32_t temperatureAge = MS5611_ENERGY_TEMPERATURE_AGE,
+        uint32_t busClock = MS5611_ENERGY_BUS_CLOCK, uint32_t pullupCurrent = MS5611_ENERGY_PULLUP_CURRENT);
+private:
+    static uint32_t getInterval(uint32_t sampleCharge, uint64_t dailyCharge, uint32_t minimumInterval);
+};
+
+#endif
@@ -0,0 +1,233 @@
+#include "MS5611FlightEvents.h"
+
+MS5611FlightEvents::MS5611FlightEvents() {
+    callback = NULL;
+    context = NULL;
+    launchSpeed = MS5611_EVENTS_LAUNCH_SPEED;
+    launchAltitude = MS5611_EVENTS_LAUNCH_ALTITUDE;
+    apogeeSpeed = MS5611_EVENTS_APOGEE_SPEED;
+    apogeeDrop = MS5611_EVENTS_APOGEE_DROP;
+    landingSpeed = MS5611_EVENTS_LANDING_SPEED;
+    landingDuration = MS5611_EVENTS_LANDING_DURATION;
+    landingAltitude = MS5611_EVENTS_LANDING_ALTITUDE;
+    confirmation = MS5611_EVENTS_CONFIRMATION;
+    begin(0);
+}
+
+/**
+ * @brief Arms the detector on the ground.
+ *
+ * @param groundAltitude Altitude of the launch site in centimetres, in the same reference as the updates.
+ *
+ * This function clears all flight state, so it can also be used to re-arm the detector after landing.
+ */
+void MS5611FlightEvents::begin(int32_t groundAltitude) {
+    this->groundAltitude = groundAltitude;
+    phase = GROUND;
+    counter = 0;
+    peakAltitude = groundAltitude;
+    peakTime = 0;
+    stillSince = 0;
+}
+
+/**
+ * @brief Registers the event handler.
+ *
+ * @param callback Function called once per event with the event altitude in centimetres and its timestamp
+ * in milliseconds. NULL disables notification; the state getters keep working.
+ * @param context Pointer passed back to the callback unchanged.
+ */
+void MS5611FlightEvents::setCallback(MS5611EventCallback callback, void *context) {
+    this->callback = callback;
+    this->context = context;
+}
+
+/**
+ * @brief Configures launch detection.
+ *
+ * @param speed Minimum vertical speed in cm/s.
+ * @param altitude Minimum height above ground in centimetres.
+ *
+ * Both conditions must hold, so a pressure gust on the pad, which moves the speed but not the height for
+ * long, does not trigger a launch.
+ */
+void MS5611FlightEvents::setLaunch(int32_t speed, int32_t altitude) {
+    launchSpeed = speed;
+    launchAltitude = altitude;
+}
+
+/**
+ * @brief Configures apogee detection.
+ *
+ * @param speed Descent speed in cm/s that marks the vertical speed as past its zero crossing.
+ * @param drop Height loss below the peak in centimetres that marks apogee on its own.
+ *
+ * Either condition triggers. The speed threshold reacts first in a clean flight; the drop threshold is a
+ * fallback for a speed estimate disturbed by ejection pressure spikes. Both act as a hysteresis band
+ * against noise around the peak.
+ */
+void MS5611FlightEvents::setApogee(int32_t speed, int32_t drop) {
+    apogeeSpeed = speed;
+    apogeeDrop = drop;
+}
+
+/**
+ * @brief Configures landing detection.
+ *
+ * @param speed Maximum absolute vertical speed in cm/s while at rest.
+ * @param duration Time in milliseconds the speed must stay within the limit.
+ * @param altitude Maximum distance from the ground altitude in centimetres while at rest.
+ *
+ * Both limits must hold for the whole duration, so a hover or a stall under a parachute high above the
+ * launch site is not reported as a landing. Raise the altitude limit when the landing site may lie well
+ * above or below the launch site.
+ */
+void MS5611FlightEvents::setLanding(int32_t speed, uint32_t duration, int32_t altitude) {
+    landingSpeed = speed;
+    landingDuration = duration;
+    landingAltitude = altitude;
+}
+
+/**
+ * @brief Sets the number of consecutive updates a launch or apogee condition must hold.
+ *
+ * @param count Update count. 1 fires on the first matching update with the lowest latency.
+ */
+void MS5611FlightEvents::setConfirmation(uint8_t count) {
+    confirmation = count > 0 ? count : 1;
+}
+
+/**
+ * @brief Advances the detector by one filtered sample.
+ *
+ * @param altitude Filtered altitude in centimetres.
+ * @param verticalSpeed Filtered vertical speed in cm/s, positive up.
+ * @param timestamp Sample time in milliseconds.
+ *
+ * This function is meant to be called right after the filter update of every sample, so events are
+ * detected within `confirmation` samples of the condition instead of at the next poll of the main loop.
+ * The detector walks through ground, ascent, descent and landed, firing each event once. The apogee
+ * event reports the highest altitude seen and the time it was reached, not the time of detection. Landing
+ * requires the vehicle to be at rest near the ground altitude, and reports the time it came to rest.
+ */
+void MS5611FlightEvents::update(int32_t altitude, int32_t verticalSpeed, uint32_t timestamp) {
+    switch(phase) {
+    case GROUND:
+        if(confirm(verticalSpeed >= launchSpeed && altitude - groundAltitude >= launchAltitude)) {
+            phase = ASCENT;
+            peakAltitude = altitude;
+            peakTime = timestamp;
+            fire(LAUNCH_EVENT, altitude, timestamp);
+        }
+        break;
+    case ASCENT:
+        if(altitude > peakAltitude) {
+            peakAltitude = altitude;
+            peakTime = timestamp;
+        }
+        if(confirm(verticalSpeed <= -apogeeSpeed || peakAltitude - altitude >= apogeeDrop)) {
+            phase = DESCENT;
+            stillSince = timestamp;
+            fire(APOGEE_EVENT, peakAltitude, peakTime);
+        }
+        break;
+    case DESCENT:
+        if(verticalSpeed > landingSpeed || verticalSpeed < -landingSpeed
+            || altitude - groundAltitude > landingAltitude || altitude - groundAltitude < -landingAltitude) {
+            stillSince = timestamp;
+        } else if(timestamp - stillSince >= landingDuration) {
+            phase = LANDED;
+            fire(LANDING_EVENT, altitude, stillSince);
+        }
+        break;
+    case LANDED:
+        break;
+    }
+}
+
+/**
+ * @brief Advances the detector with the current output of a fusion filter.
+ *
+ * @param fusion Filter that was just updated.
+ * @param timestamp Sample time in milliseconds.
+ */
+void MS5611FlightEvents::update(MS5611Fusion &fusion, uint32_t timestamp) {
+    update(fusion.getAltitude(), fusion.getVerticalSpeed(), timestamp);
+}
+
+/**
+ * @brief Checks whether launch was detected.
+ *
+ * @return True from the launch event on.
+ */
+bool MS5611FlightEvents::isLaunched(void) {
+    return phase != GROUND;
+}
+
+/**
+ * @brief Checks whether apogee was detected.
+ *
+ * @return True from the apogee event on.
+ */
+bool MS5611FlightEvents::isPastApogee(void) {
+    return phase == DESCENT || phase == LANDED;
+}
+
+/**
+ * @brief Checks whether landing was detected.
+ *
+ * @return True from the landing event on.
+ */
+bool MS5611FlightEvents::isLanded(void) {
+    return phase == LANDED;
+}
+
+/**
+ * @brief Retrieves the highest altitude of the flight.
+ *
+ * @return The peak altitude in centimetres, updated live during ascent.
+ */
+int32_t MS5611FlightEvents::getApogee(void) {
+    return peakAltitude;
+}
+
+/**
+ * @brief Retrieves the time the peak altitude was reached.
+ *
+ * @return The timestamp in milliseconds.
+ */
+uint32_t MS5611FlightEvents::getApogeeTime(void) {
+    return peakTime;
+}
+
+/**
+ * @brief Notifies the registered handler.
+ *
+ * @param event Detected event.
+ * @param altitude Event altitude in centimetres.
+ * @param timestamp Event time in milliseconds.
+ */
+void MS5611FlightEvents::fire(MS5611_event event, int32_t altitude, uint32_t timestamp) {
+    if(callback != NULL) {
+        callback(event, altitude, timestamp, context);
+    }
+}
+
+/**
+ * @brief Counts consecutive updates for which a condition holds.
+ *
+ * @param condition Condition of the current update.
+ * @return True once the condition held for `confirmation` updates in a row. The count restarts afterwards.
+ */
+bool MS5611FlightEvents::confirm(bool condition) {
+    if(!condition) {
+        counter = 0;
+        return false;
+    }
+    counter++;
+    if(counter < confirmation) {
+        return false;
+    }
+    counter = 0;
+    return true;
+}
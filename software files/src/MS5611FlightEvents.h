@@ -0,0 +1,69 @@
+#ifndef MS5611FlightEvents_h
+#define MS5611FlightEvents_h
+
+#include "Arduino.h"
+#include "MS5611Fusion.h"
+
+#define MS5611_EVENTS_LAUNCH_SPEED 500
+#define MS5611_EVENTS_LAUNCH_ALTITUDE 1000
+#define MS5611_EVENTS_APOGEE_SPEED 100
+#define MS5611_EVENTS_APOGEE_DROP 200
+#define MS5611_EVENTS_LANDING_SPEED 50
+#define MS5611_EVENTS_LANDING_DURATION 2000
+#define MS5611_EVENTS_LANDING_ALTITUDE 1000
+#define MS5611_EVENTS_CONFIRMATION 2
+
+    enum MS5611_event {
+        LAUNCH_EVENT  = 0,
+        APOGEE_EVENT  = 1,
+        LANDING_EVENT = 2
+    };
+
+typedef void (*MS5611EventCallback)(MS5611_event event, int32_t altitude, uint32_t timestamp, void *context);
+
+class MS5611FlightEvents {
+public:
+    MS5611FlightEvents();
+    void begin(int32_t groundAltitude);
+    void setCallback(MS5611EventCallback callback, void *context = NULL);
+    void setLaunch(int32_t speed, int32_t altitude);
+    void setApogee(int32_t speed, int32_t drop);
+    void setLanding(int32_t speed, uint32_t duration, int32_t altitude = MS5611_EVENTS_LANDING_ALTITUDE);
+    void setConfirmation(uint8_t count);
+    void update(int32_t altitude, int32_t verticalSpeed, uint32_t timestamp);
+    void update(MS5611Fusion &fusion, uint32_t timestamp);
+    bool isLaunched(void);
+    bool isPastApogee(void);
+    bool isLanded(void);
+    int32_t getApogee(void);
+    uint32_t getApogeeTime(void);
+private:
+    enum Phase {
+        GROUND,
+        ASCENT,
+        DESCENT,
+        LANDED
+    };
+
+    MS5611EventCallback callback;
+    void *context;
+    Phase phase;
+    int32_t groundAltitude;
+    int32_t launchSpeed;
+    int32_t launchAltitude;
+    int32_t apogeeSpeed;
+    int32_t apogeeDrop;
+    int32_t landingSpeed;
+    uint32_t landingDuration;
+    int32_t landingAltitude;
+    uint8_t confirmation;
+    uint8_t counter;
+    int32_t peakAltitude;
+    uint32_t peakTime;
+    uint32_t stillSince;
+
+    void fire(MS5611_event event, int32_t altitude, uint32_t timestamp);
+    bool confirm(bool condition);
+};
+
+#endif
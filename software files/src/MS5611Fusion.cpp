@@ -0,0 +1,79 @@
+#include "MS5611Fusion.h"
+
+MS5611Fusion::MS5611Fusion() {
+    timeConstant = MS5611_FUSION_DEFAULT_TIME_CONSTANT;
+    begin(0, MS5611_FUSION_DEFAULT_TIME_CONSTANT);
+}
+
+/**
+ * @brief Initializes the filter state.
+ *
+ * @param altitude Starting altitude in centimetres, usually the first barometric altitude.
+ * @param timeConstant Crossover time constant in milliseconds.
+ *
+ * This function resets the altitude estimate to the given value and clears the vertical speed and
+ * the accelerometer bias estimate. All state is held in Q16 fixed point centimetre units.
+ */
+void MS5611Fusion::begin(int32_t altitude, uint16_t timeConstant) {
+    this->altitude = (int64_t)altitude * 65536;
+    verticalSpeed = 0;
+    accelerationBias = 0;
+    setTimeConstant(timeConstant);
+}
+
+/**
+ * @brief Sets the crossover time constant of the complementary filter.
+ *
+ * @param timeConstant Time constant in milliseconds.
+ *
+ * Below this time scale the estimate follows the integrated accelerometer, above it the barometer.
+ * Shorter values trust the barometer more and reject less pressure noise.
+ */
+void MS5611Fusion::setTimeConstant(uint16_t timeConstant) {
+    this->timeConstant = timeConstant > 0 ? timeConstant : 1;
+}
+
+/**
+ * @brief Advances the filter by one step.
+ *
+ * @param baroAltitude Barometric altitude in centimetres.
+ * @param acceleration Vertical acceleration in cm/s², positive up, with gravity removed.
+ * @param elapsed Time since the previous update in microseconds.
+ *
+ * This function runs a third-order complementary filter. The barometric error corrects the
+ * altitude, the vertical speed and a slowly adapting accelerometer bias with gains 3/τ, 3/τ² and
+ * 1/τ³, which places all three filter poles at -1/τ. The accelerometer is integrated first and the
+ * barometric altitude is compared with the altitude predicted for its own sample time, so the altitude
+ * output has neither barometer filtering lag nor a one-step lag during fast climbs.
+ */
+void MS5611Fusion::update(int32_t baroAltitude, int32_t acceleration, uint32_t elapsed) {
+    int64_t tau = timeConstant;
+    int64_t dt = elapsed;
+
+    int64_t totalAcceleration = (int64_t)acceleration * 65536 + accelerationBias;
+    verticalSpeed += totalAcceleration * dt / 1000000;
+    altitude += verticalSpeed * dt / 1000000;
+
+    int64_t error = (int64_t)baroAltitude * 65536 - altitude;
+    accelerationBias += error * dt * 1000 / (tau * tau * tau);
+    verticalSpeed += 3 * error * dt / (tau * tau);
+    altitude += 3 * error * dt / (tau * 1000);
+}
+
+/**
+ * @brief Retrieves the fused altitude.
+ *
+ * @return The altitude estimate in centimetres.
+ */
+int32_t MS5611Fusion::getAltitude(void) {
+    return (int32_t)(altitude / 65536);
+}
+
+/**
+ * @brief Retrieves the fused vertical speed.
+ *
+ * @return The vertical speed estimate in cm/s, positive up.
+ */
+int32_t MS5611Fusion::getVerticalSpeed(void) {
+    return (int32_t)(verticalSpeed / 65536);
+}
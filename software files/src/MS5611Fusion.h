@@ -0,0 +1,23 @@
+#ifndef MS5611Fusion_h
+#define MS5611Fusion_h
+
+#include "Arduino.h"
+
+#define MS5611_FUSION_DEFAULT_TIME_CONSTANT 1000
+
+class MS5611Fusion {
+public:
+    MS5611Fusion();
+    void begin(int32_t altitude, uint16_t timeConstant = MS5611_FUSION_DEFAULT_TIME_CONSTANT);
+    void setTimeConstant(uint16_t timeConstant);
+    void update(int32_t baroAltitude, int32_t acceleration, uint32_t elapsed);
+    int32_t getAltitude(void);
+    int32_t getVerticalSpeed(void);
+private:
+    int64_t altitude;
+    int64_t verticalSpeed;
+    int64_t accelerationBias;
+    uint16_t timeConstant;
+};
+
+#endif
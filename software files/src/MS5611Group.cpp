@@ -0,0 +1,333 @@
+#include "MS5611Group.h"
+
+MS5611Group::MS5611Group() {
+    sensorCount = 0;
+    faultThreshold = MS5611_GROUP_FAULT_THRESHOLD;
+    faultLimit = MS5611_GROUP_FAULT_COUNT;
+}
+
+/**
+ * @brief Adds a sensor to the group.
+ *
+ * @param sensor MS5611 instance, initialized either by its own `begin` or by the group `begin`. Sensors on one
+ * bus must use different addresses.
+ * @param weight Relative weight of the sensor in the voted output.
+ * @return A boolean value indicating whether the sensor was added or the group is full.
+ *
+ * Sensors are sampled in the order they were added.
+ */
+bool MS5611Group::add(MS5611 &sensor, uint8_t weight) {
+    if(sensorCount >= MS5611_GROUP_MAX_SENSORS) {
+        return false;
+    }
+    sensors[sensorCount] = &sensor;
+    weights[sensorCount] = weight > 0 ? weight : 1;
+    faultCounter[sensorCount] = 0;
+    healthy[sensorCount] = true;
+    valid[sensorCount] = false;
+    pressures[sensorCount] = 0;
+    sensorCount++;
+    return true;
+}
+
+/**
+ * @brief Initializes all sensors of the group together.
+ *
+ * @param osr Oversampling rate for every sensor.
+ * @return A boolean value indicating whether every sensor returned plausible calibration data.
+ *
+ * This function replaces calling `MS5611::begin` on each sensor. It resets all sensors back-to-back,
+ * waits MS5611_RESET_DELAY milliseconds once and then reads the calibration coefficients interleaved
+ * across sensors, so startup time is dominated by a single reset wait regardless of sensor count.
+ * Sensors must be added with `add` first.
+ */
+bool MS5611Group::begin(MS5611_osr osr) {
+    for(uint8_t index = 0; index < sensorCount; index++) {
+        sensors[index]->beginReset(osr);
+    }
+
+    delay(MS5611_RESET_DELAY);
+
+    for(uint8_t offset = 0; offset < 6; offset++) {
+        for(uint8_t index = 0; index < sensorCount; index++) {
+            sensors[index]->readCalibrationCoefficient(offset);
+        }
+    }
+
+    bool success = true;
+    for(uint8_t index = 0; index < sensorCount; index++) {
+        healthy[index] = sensors[index]->isCalibrationValid();
+        faultCounter[index] = healthy[index] ? 0 : faultLimit;
+        success = success && healthy[index];
+    }
+    return success;
+}
+
+/**
+ * @brief Configures fault isolation.
+ *
+ * @param threshold Maximum deviation from the group median in Pa before a reading counts as divergent.
+ * @param count Number of consecutive divergent cycles before a sensor is isolated.
+ *
+ * An isolated sensor keeps being sampled and rejoins the vote after the same number of agreeing cycles.
+ */
+void MS5611Group::setFaultDetection(int32_t threshold, uint8_t count) {
+    faultThreshold = threshold;
+    faultLimit = count > 0 ? count : 1;
+}
+
+/**
+ * @brief Runs one acquisition cycle and votes on the result.
+ *
+ * @param pressure Receives the voted pressure in Pa.
+ * @param compensation Flag to enable second order pressure compensation.
+ * @return A boolean value indicating whether at least one healthy sensor delivered a reading.
+ *
+ * This function starts D1 conversions on every sensor back-to-back, waits once for the longest conversion
+ * time and reads all results in the same order, then does the same for D2. Each sensor therefore gets
+ * at least its full conversion time and the cycle always takes the same time regardless of sensor count.
+ * The output is the median of the healthy sensors, refined by a weighted mean of the readings within the
+ * fault threshold of that median. With three or more readings, sensors that keep diverging are isolated.
+ */
+bool MS5611Group::read(int32_t &pressure, bool compensation) {
+    acquire(compensation);
+
+    bool success;
+    int32_t median = vote(success);
+    if(!success) {
+        return false;
+    }
+
+    int64_t weightedSum = 0;
+    uint16_t weightTotal = 0;
+    for(uint8_t index = 0; index < sensorCount; index++) {
+        if(!valid[index] || !healthy[index]) {
+            continue;
+        }
+        int32_t deviation = pressures[index] - median;
+        if(deviation <= faultThreshold && deviation >= -faultThreshold) {
+            weightedSum += (int64_t)pressures[index] * weights[index];
+            weightTotal += weights[index];
+        }
+    }
+    pressure = weightTotal > 0 ? (int32_t)(weightedSum / weightTotal) : median;
+
+    isolateFaults(median);
+    return true;
+}
+
+/**
+ * @brief Runs one acquisition cycle and returns the voted pressure.
+ *
+ * @param compensation Flag to enable second order pressure compensation.
+ * @return The voted pressure in Pa, or 0 if no healthy sensor delivered a reading.
+ */
+int32_t MS5611Group::readPressure(bool compensation) {
+    int32_t pressure = 0;
+    read(pressure, compensation);
+    return pressure;
+}
+
+/**
+ * @brief Retrieves the number of sensors in the group.
+ *
+ * @return The number of added sensors.
+ */
+uint8_t MS5611Group::getSensorCount(void) {
+    return sensorCount;
+}
+
+/**
+ * @brief Retrieves the number of sensors that take part in voting.
+ *
+ * @return The number of sensors that are not isolated.
+ */
+uint8_t MS5611Group::getHealthyCount(void) {
+    uint8_t count = 0;
+    for(uint8_t index = 0; index < sensorCount; index++) {
+        if(healthy[index]) {
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Checks whether a sensor takes part in voting.
+ *
+ * @param index Sensor index in the order of `add`.
+ * @return False if the sensor is isolated or the index is out of range.
+ */
+bool MS5611Group::isHealthy(uint8_t index) {
+    return index < sensorCount && healthy[index];
+}
+
+/**
+ * @brief Retrieves the pressure one sensor reported in the last cycle.
+ *
+ * @param index Sensor index in the order of `add`.
+ * @return The pressure in Pa, or 0 if the sensor delivered no reading.
+ */
+int32_t MS5611Group::getSensorPressure(uint8_t index) {
+    if(index >= sensorCount || !valid[index]) {
+        return 0;
+    }
+    return pressures[index];
+}
+
+/**
+ * @brief Samples every sensor with staggered D1 and D2 conversions.
+ *
+ * @param compensation Flag to enable second order pressure compensation.
+ *
+ * The conversion time is counted from the end of the first start of each phase. Results are read in the
+ * order the conversions were started and a read takes longer on the bus than a start, so every sensor has
+ * had its full conversion time when it is read, and the other start transfers overlap the wait instead of
+ * adding to it, as in MS5611MuxArray.
+ * `readConversion` returns 0 when the sensor did not acknowledge, answered short or had not finished
+ * converting; such readings are marked invalid for this cycle.
+ */
+void MS5611Group::acquire(bool compensation) {
+    uint32_t D1[MS5611_GROUP_MAX_SENSORS];
+    uint32_t D2[MS5611_GROUP_MAX_SENSORS];
+    uint32_t conversionTime = (uint32_t)getConversionTime() * 1000;
+    uint32_t started = 0;
+
+    for(uint8_t index = 0; index < sensorCount; index++) {
+        sensors[index]->startPressureConversion();
+        if(index == 0) {
+            started = micros();
+        }
+    }
+    waitConversion(started, conversionTime);
+    for(uint8_t index = 0; index < sensorCount; index++) {
+        D1[index] = sensors[index]->readConversion();
+    }
+
+    for(uint8_t index = 0; index < sensorCount; index++) {
+        sensors[index]->startTemperatureConversion();
+        if(index == 0) {
+            started = micros();
+        }
+    }
+    waitConversion(started, conversionTime);
+    for(uint8_t index = 0; index < sensorCount; index++) {
+        D2[index] = sensors[index]->readConversion();
+    }
+
+    for(uint8_t index = 0; index < sensorCount; index++) {
+        valid[index] = D1[index] != 0 && D2[index] != 0;
+        if(valid[index]) {
+            pressures[index] = sensors[index]->compensatePressure(D1[index], D2[index], compensation);
+        }
+    }
+}
+
+/**
+ * @brief Waits until the conversions of a phase have finished.
+ *
+ * @param started Value of micros() taken right after the first start of the phase.
+ * @param conversionTime Conversion time in microseconds.
+ */
+void MS5611Group::waitConversion(uint32_t started, uint32_t conversionTime) {
+    uint32_t elapsed = micros() - started;
+    if(elapsed < conversionTime) {
+        delayMicroseconds(conversionTime - elapsed);
+    }
+}
+
+/**
+ * @brief Retrieves the longest conversion time of all sensors.
+ *
+ * @return The conversion time in milliseconds.
+ */
+uint8_t MS5611Group::getConversionTime(void) {
+    uint8_t conversionTime = 0;
+    for(uint8_t index = 0; index < sensorCount; index++) {
+        uint8_t sensorTime = sensors[index]->getConversionTime();
+        if(sensorTime > conversionTime) {
+            conversionTime = sensorTime;
+        }
+    }
+    return conversionTime;
+}
+
+/**
+ * @brief Calculates the median of the valid readings of healthy sensors.
+ *
+ * @param success Set to false if no healthy sensor delivered a reading.
+ * @return The median pressure in Pa. For an even count the two middle readings are averaged.
+ */
+int32_t MS5611Group::vote(bool &success) {
+    int32_t sorted[MS5611_GROUP_MAX_SENSORS];
+    uint8_t count = 0;
+
+    for(uint8_t index = 0; index < sensorCount; index++) {
+        if(!valid[index] || !healthy[index]) {
+            continue;
+        }
+        int32_t value = pressures[index];
+        uint8_t position = count;
+        while(position > 0 && sorted[position - 1] > value) {
+            sorted[position] = sorted[position - 1];
+            position--;
+        }
+        sorted[position] = value;
+        count++;
+    }
+
+    success = count > 0;
+    if(!success) {
+        return 0;
+    }
+    if(count % 2 == 0) {
+        return (int32_t)(((int64_t)sorted[count / 2 - 1] + sorted[count / 2]) / 2);
+    }
+    return sorted[count / 2];
+}
+
+/**
+ * @brief Updates the fault counters of all sensors against the group median.
+ *
+ * @param median Median pressure of the current cycle in Pa.
+ *
+ * A divergent sensor cannot be identified from two readings, so deviations are only evaluated when at
+ * least three sensors delivered a reading; otherwise the state of the answering sensors is kept. Missing
+ * readings always count as divergent.
+ */
+void MS5611Group::isolateFaults(int32_t median) {
+    uint8_t validCount = 0;
+    for(uint8_t index = 0; index < sensorCount; index++) {
+        if(valid[index]) {
+            validCount++;
+        }
+    }
+
+    for(uint8_t index = 0; index < sensorCount; index++) {
+        bool divergent;
+        if(!valid[index]) {
+            divergent = true;
+        } else if(validCount < 3) {
+            continue;
+        } else {
+            int32_t deviation = pressures[index] - median;
+            divergent = deviation > faultThreshold || deviation < -faultThreshold;
+        }
+
+        if(divergent) {
+            if(faultCounter[index] < faultLimit) {
+                faultCounter[index]++;
+            }
+            if(faultCounter[index] >= faultLimit) {
+                healthy[index] = false;
+            }
+        } else {
+            if(faultCounter[index] > 0) {
+                faultCounter[index]--;
+            }
+            if(faultCounter[index] == 0) {
+                healthy[index] = true;
+            }
+        }
+    }
+}
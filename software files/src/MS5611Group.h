@@ -0,0 +1,43 @@
+#ifndef MS5611Group_h
+#define MS5611Group_h
+
+#include "Arduino.h"
+#include "MS5611.h"
+
+#ifndef MS5611_GROUP_MAX_SENSORS
+#define MS5611_GROUP_MAX_SENSORS 3
+#endif
+#define MS5611_GROUP_FAULT_THRESHOLD 50
+#define MS5611_GROUP_FAULT_COUNT 3
+
+class MS5611Group {
+public:
+    MS5611Group();
+    bool add(MS5611 &sensor, uint8_t weight = 1);
+    bool begin(MS5611_osr osr = HIGH_RES);
+    void setFaultDetection(int32_t threshold, uint8_t count = MS5611_GROUP_FAULT_COUNT);
+    bool read(int32_t &pressure, bool compensation = false);
+    int32_t readPressure(bool compensation = false);
+    uint8_t getSensorCount(void);
+    uint8_t getHealthyCount(void);
+    bool isHealthy(uint8_t index);
+    int32_t getSensorPressure(uint8_t index);
+private:
+    MS5611 *sensors[MS5611_GROUP_MAX_SENSORS];
+    uint8_t weights[MS5611_GROUP_MAX_SENSORS];
+    uint8_t faultCounter[MS5611_GROUP_MAX_SENSORS];
+    bool healthy[MS5611_GROUP_MAX_SENSORS];
+    bool valid[MS5611_GROUP_MAX_SENSORS];
+    int32_t pressures[MS5611_GROUP_MAX_SENSORS];
+    uint8_t sensorCount;
+    int32_t faultThreshold;
+    uint8_t faultLimit;
+
+    void acquire(bool compensation);
+    void waitConversion(uint32_t started, uint32_t conversionTime);
+    uint8_t getConversionTime(void);
+    int32_t vote(bool &success);
+    void isolateFaults(int32_t median);
+};
+
+#endif
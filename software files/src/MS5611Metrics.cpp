@@ -0,0 +1,141 @@
+#include "MS5611Metrics.h"
+
+#ifndef MS5611_NO_STATISTICS
+MS5611Metrics::MS5611Metrics() {
+    entryCount = 0;
+    lastTimestamp = 0;
+}
+
+/**
+ * @brief Adds a sensor to the exported set.
+ *
+ * @param sensor Sensor whose statistics are exported.
+ * @param name Value of the `sensor` label. The string must stay valid and must not contain quotes.
+ * @return False if the sensor table is full.
+ */
+bool MS5611Metrics::add(MS5611 &sensor, const char *name) {
+    if(entryCount >= MS5611_METRICS_MAX_SENSORS) {
+        return false;
+    }
+    entries[entryCount].sensor = &sensor;
+    entries[entryCount].name = name;
+    entries[entryCount].conversions = sensor.getStatistics().conversions;
+    entryCount++;
+    return true;
+}
+
+/**
+ * @brief Writes the statistics of all sensors in the Prometheus text exposition format.
+ *
+ * @param output Destination, e.g. a connected network client or Serial.
+ * @param timestamp Current time in milliseconds, used for the sample rate.
+ *
+ * This function exports the conversion, incomplete conversion and bus error counters, the conversion
+ * latency histogram in milliseconds with its sum and count, and the completed conversion rate in
+ * millihertz since the previous call. The driver only increments counters while sampling; all formatting
+ * cost is paid here, by the caller that serves the scrape, so this should be called from the network
+ * side of the application rather than between conversions.
+ */
+void MS5611Metrics::print(Print &output, uint32_t timestamp) {
+    uint32_t elapsed = timestamp - lastTimestamp;
+    lastTimestamp = timestamp;
+
+    printHeader(output, "ms5611_conversions_total", "counter", "Completed ADC conversions.");
+    for(uint8_t index = 0; index < entryCount; index++) {
+        printValue(output, "ms5611_conversions_total", index, NULL, entries[index].sensor->getStatistics().conversions);
+    }
+
+    printHeader(output, "ms5611_incomplete_conversions_total", "counter", "ADC reads before the conversion finished.");
+    for(uint8_t index = 0; index < entryCount; index++) {
+        printValue(output, "ms5611_incomplete_conversions_total", index, NULL, entries[index].sensor->getStatistics().incompleteConversions);
+    }
+
+    printHeader(output, "ms5611_bus_errors_total", "counter", "Unacknowledged or short I2C transfers.");
+    for(uint8_t index = 0; index < entryCount; index++) {
+        printValue(output, "ms5611_bus_errors_total", index, NULL, entries[index].sensor->getStatistics().busErrors);
+    }
+
+    printHeader(output, "ms5611_sample_rate_millihertz", "gauge", "Completed conversions per second since the last scrape.");
+    for(uint8_t index = 0; index < entryCount; index++) {
+        uint32_t conversions = entries[index].sensor->getStatistics().conversions;
+        uint32_t rate = elapsed > 0 ? (uint32_t)((uint64_t)(conversions - entries[index].conversions) * 1000000 / elapsed) : 0;
+        entries[index].conversions = conversions;
+        printValue(output, "ms5611_sample_rate_millihertz", index, NULL, rate);
+    }
+
+    printHeader(output, "ms5611_conversion_latency_milliseconds", "histogram", "Time from conversion start to read.");
+    for(uint8_t index = 0; index < entryCount; index++) {
+        const MS5611Statistics &statistics = entries[index].sensor->getStatistics();
+        uint32_t cumulative = 0;
+        for(uint8_t bucket = 0; bucket < MS5611_LATENCY_BUCKETS; bucket++) {
+            cumulative += statistics.latency[bucket];
+            if(bucket < MS5611_LATENCY_BUCKETS - 1) {
+                printBucket(output, index, 1UL << bucket, cumulative);
+            }
+        }
+        printBucket(output, index, 0, cumulative);
+        printValue(output, "ms5611_conversion_latency_milliseconds", index, "_sum", statistics.latencySum);
+        printValue(output, "ms5611_conversion_latency_milliseconds", index, "_count", cumulative);
+    }
+}
+
+/**
+ * @brief Writes the HELP and TYPE lines of a metric.
+ *
+ * @param output Destination.
+ * @param metric Metric name.
+ * @param type Prometheus metric type.
+ * @param help Description.
+ */
+void MS5611Metrics::printHeader(Print &output, const char *metric, const char *type, const char *help) {
+    output.print("# HELP ");
+    output.print(metric);
+    output.print(" ");
+    output.println(help);
+    output.print("# TYPE ");
+    output.print(metric);
+    output.print(" ");
+    output.println(type);
+}
+
+/**
+ * @brief Writes one sample line.
+ *
+ * @param output Destination.
+ * @param metric Metric name.
+ * @param index Sensor entry.
+ * @param suffix Appended to the metric name, or NULL.
+ * @param value Sample value.
+ */
+void MS5611Metrics::printValue(Print &output, const char *metric, uint8_t index, const char *suffix, uint32_t value) {
+    output.print(metric);
+    if(suffix != NULL) {
+        output.print(suffix);
+    }
+    output.print("{sensor=\"");
+    output.print(entries[index].name);
+    output.print("\"} ");
+    output.println(value);
+}
+
+/**
+ * @brief Writes one cumulative histogram bucket of the conversion latency.
+ *
+ * @param output Destination.
+ * @param index Sensor entry.
+ * @param bound Inclusive upper bound in milliseconds, or 0 for the +Inf bucket.
+ * @param value Number of conversions at or below the bound.
+ */
+void MS5611Metrics::printBucket(Print &output, uint8_t index, uint32_t bound, uint32_t value) {
+    output.print("ms5611_conversion_latency_milliseconds_bucket{sensor=\"");
+    output.print(entries[index].name);
+    output.print("\",le=\"");
+    if(bound > 0) {
+        output.print(bound);
+    } else {
+        output.print("+Inf");
+    }
+    output.print("\"} ");
+    output.println(value);
+}
+#endif
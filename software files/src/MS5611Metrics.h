@@ -0,0 +1,34 @@
+#ifndef MS5611Metrics_h
+#define MS5611Metrics_h
+
+#include "Arduino.h"
+#include "MS5611.h"
+
+#ifndef MS5611_METRICS_MAX_SENSORS
+#define MS5611_METRICS_MAX_SENSORS 8
+#endif
+
+#ifndef MS5611_NO_STATISTICS
+class MS5611Metrics {
+public:
+    MS5611Metrics();
+    bool add(MS5611 &sensor, const char *name);
+    void print(Print &output, uint32_t timestamp);
+private:
+    struct Entry {
+        MS5611 *sensor;
+        const char *name;
+        uint32_t conversions;
+    };
+
+    Entry entries[MS5611_METRICS_MAX_SENSORS];
+    uint8_t entryCount;
+    uint32_t lastTimestamp;
+
+    void printHeader(Print &output, const char *metric, const char *type, const char *help);
+    void printValue(Print &output, const char *metric, uint8_t index, const char *suffix, uint32_t value);
+    void printBucket(Print &output, uint8_t index, uint32_t bound, uint32_t value);
+};
+#endif
+
+#endif
@@ -0,0 +1,345 @@
+#include "MS5611Mux.h"
+
+/**
+ * @brief Creates a driver instance for a TCA9548A-style I2C multiplexer.
+ *
+ * @param address I2C address of the multiplexer.
+ * @param wire I2C bus the multiplexer is connected to.
+ */
+MS5611Mux::MS5611Mux(uint8_t address, TwoWire &wire) {
+    this->address = address;
+    this->wire = &wire;
+    channel = MS5611_MUX_NO_CHANNEL;
+    switchCount = 0;
+}
+
+/**
+ * @brief Connects one downstream channel to the bus.
+ *
+ * @param channel Channel number, 0 to MS5611_MUX_CHANNELS - 1.
+ * @return A boolean value indicating whether the channel is selected.
+ *
+ * The currently selected channel is cached, so selecting it again costs no bus traffic.
+ */
+bool MS5611Mux::select(uint8_t channel) {
+    if(channel >= MS5611_MUX_CHANNELS) {
+        return false;
+    }
+    if(channel == this->channel) {
+        return true;
+    }
+    if(!writeChannelMask(1 << channel)) {
+        this->channel = MS5611_MUX_NO_CHANNEL;
+        return false;
+    }
+    this->channel = channel;
+    return true;
+}
+
+/**
+ * @brief Disconnects all downstream channels.
+ *
+ * @return A boolean value indicating whether the multiplexer acknowledged the command.
+ */
+bool MS5611Mux::disable(void) {
+    channel = MS5611_MUX_NO_CHANNEL;
+    return writeChannelMask(0);
+}
+
+/**
+ * @brief Retrieves the currently selected channel.
+ *
+ * @return The channel number, or MS5611_MUX_NO_CHANNEL if none is selected.
+ */
+uint8_t MS5611Mux::getChannel(void) {
+    return channel;
+}
+
+/**
+ * @brief Retrieves the number of channel switches written to the multiplexer.
+ *
+ * @return The switch count, wrapping at 65535.
+ */
+uint16_t MS5611Mux::getSwitchCount(void) {
+    return switchCount;
+}
+
+/**
+ * @brief Writes the channel enable mask to the multiplexer control register.
+ *
+ * @param mask One bit per channel.
+ * @return A boolean value indicating whether the multiplexer acknowledged the write.
+ */
+bool MS5611Mux::writeChannelMask(uint8_t mask) {
+    wire->beginTransmission(address);
+    wire->write(mask);
+    switchCount++;
+    return wire->endTransmission() == 0;
+}
+
+/**
+ * @brief Creates an empty sensor array behind one or more multiplexers.
+ *
+ * @param mux Multiplexer used by `add` when no other one is given.
+ *
+ * One TCA9548A connects at most 8 channels with two sensor addresses each, i.e. 16 sensors. Larger arrays
+ * put further multiplexers at 0x71 to 0x77 on the same bus and add their sensors with the multiplexer
+ * they hang off; raise MS5611_MUX_ARRAY_MAX_SENSORS accordingly.
+ */
+MS5611MuxArray::MS5611MuxArray(MS5611Mux &mux) {
+    this->mux = &mux;
+    selectedMux = NULL;
+    sensorCount = 0;
+    temperatureInterval = MS5611_MUX_ARRAY_TEMPERATURE_INTERVAL;
+    temperatureCounter = 0;
+}
+
+/**
+ * @brief Adds a sensor behind the multiplexer given to the constructor.
+ *
+ * @param sensor MS5611 instance, initialized either by its own `begin` or by the array `begin`.
+ * @param channel Multiplexer channel the sensor is connected to.
+ * @return A boolean value indicating whether the sensor was added or the array is full.
+ */
+bool MS5611MuxArray::add(MS5611 &sensor, uint8_t channel) {
+    return add(sensor, *mux, channel);
+}
+
+/**
+ * @brief Adds a sensor behind a given multiplexer.
+ *
+ * @param sensor MS5611 instance, initialized either by its own `begin` or by the array `begin`.
+ * @param mux Multiplexer the sensor is connected through, on the same bus as the others.
+ * @param channel Multiplexer channel the sensor is connected to.
+ * @return A boolean value indicating whether the sensor was added or the array is full.
+ *
+ * Sensors keep the index of the order they were added in, but are stored grouped by multiplexer and
+ * sorted by channel, so each acquisition phase visits every channel exactly once.
+ */
+bool MS5611MuxArray::add(MS5611 &sensor, MS5611Mux &mux, uint8_t channel) {
+    if(sensorCount >= MS5611_MUX_ARRAY_MAX_SENSORS || channel >= MS5611_MUX_CHANNELS) {
+        return false;
+    }
+
+    uint8_t position = sensorCount;
+    for(uint8_t current = 0; current < sensorCount; current++) {
+        if(entries[current].mux != &mux) {
+            continue;
+        }
+        if(entries[current].channel > channel) {
+            position = current;
+            break;
+        }
+        position = current + 1;
+    }
+    for(uint8_t current = sensorCount; current > position; current--) {
+        entries[current] = entries[current - 1];
+        order[entries[current].index] = current;
+    }
+
+    entries[position].sensor = &sensor;
+    entries[position].mux = &mux;
+    entries[position].channel = channel;
+    entries[position].index = sensorCount;
+    entries[position].valid = false;
+    entries[position].temperature = 0;
+    entries[position].pressure = 0;
+    entries[position].compensatedPressure = 0;
+    order[sensorCount] = position;
+    sensorCount++;
+    temperatureCounter = 0;
+    return true;
+}
+
+/**
+ * @brief Initializes all sensors of the array together.
+ *
+ * @param osr Oversampling rate for every sensor.
+ * @return A boolean value indicating whether every channel could be selected and every sensor returned
+ * plausible calibration data.
+ *
+ * This function replaces calling `MS5611::begin` on each sensor. It resets all sensors channel by
+ * channel, waits MS5611_RESET_DELAY milliseconds once and then reads the calibration coefficients of
+ * all sensors in channel order, so every channel is selected once per step. Startup time is dominated
+ * by a single reset wait regardless of sensor count.
+ */
+bool MS5611MuxArray::begin(MS5611_osr osr) {
+    for(uint8_t position = 0; position < sensorCount; position++) {
+        if(select(entries[position])) {
+            entries[position].sensor->beginReset(osr);
+        }
+    }
+
+    delay(MS5611_RESET_DELAY);
+
+    bool success = true;
+    for(uint8_t position = 0; position < sensorCount; position++) {
+        Entry &entry = entries[position];
+        if(!select(entry)) {
+            success = false;
+            continue;
+        }
+        entry.sensor->getCalibrationData();
+        success = success && entry.sensor->isCalibrationValid();
+    }
+    temperatureCounter = 0;
+    return success;
+}
+
+/**
+ * @brief Sets how often the temperature of all sensors is refreshed.
+ *
+ * @param interval Number of pressure readings per temperature refresh. 1 refreshes on every reading.
+ */
+void MS5611MuxArray::setTemperatureInterval(uint8_t interval) {
+    temperatureInterval = interval > 0 ? interval : 1;
+    temperatureCounter = 0;
+}
+
+/**
+ * @brief Runs one acquisition cycle over all sensors.
+ *
+ * @param compensation Flag to enable second order pressure compensation.
+ * @return The number of sensors that delivered a valid reading.
+ *
+ * Conversions keep running on a sensor while its channel is disconnected, so the array starts the
+ * conversion of every sensor channel by channel, waits once for the conversion time counted from the
+ * first start, and then collects the results in the same order. Each phase switches every used channel
+ * once, independent of how the sensors were added, and disables each multiplexer once when the array
+ * moves on to the next one. Temperature is refreshed every configured number of cycles the same way.
+ */
+uint8_t MS5611MuxArray::read(bool compensation) {
+    if(temperatureCounter == 0) {
+        convert(true);
+        temperatureCounter = temperatureInterval;
+    }
+    temperatureCounter--;
+
+    convert(false);
+
+    uint8_t validCount = 0;
+    for(uint8_t position = 0; position < sensorCount; position++) {
+        Entry &entry = entries[position];
+        entry.valid = entry.pressure != 0 && entry.temperature != 0;
+        if(entry.valid) {
+            entry.compensatedPressure = entry.sensor->compensatePressure(entry.pressure, entry.temperature, compensation);
+            validCount++;
+        } else {
+            temperatureCounter = 0;
+        }
+    }
+    return validCount;
+}
+
+/**
+ * @brief Retrieves the number of sensors in the array.
+ *
+ * @return The number of added sensors.
+ */
+uint8_t MS5611MuxArray::getSensorCount(void) {
+    return sensorCount;
+}
+
+/**
+ * @brief Retrieves the pressure of one sensor from the last cycle.
+ *
+ * @param index Sensor index in the order of `add`.
+ * @return The pressure in Pa, or 0 if the sensor delivered no reading.
+ */
+int32_t MS5611MuxArray::getPressure(uint8_t index) {
+    if(!isValid(index)) {
+        return 0;
+    }
+    return entries[order[index]].compensatedPressure;
+}
+
+/**
+ * @brief Checks whether a sensor delivered a reading in the last cycle.
+ *
+ * @param index Sensor index in the order of `add`.
+ * @return False if the sensor did not answer or the index is out of range.
+ */
+bool MS5611MuxArray::isValid(uint8_t index) {
+    return index < sensorCount && entries[order[index]].valid;
+}
+
+/**
+ * @brief Connects the channel of one sensor to the bus.
+ *
+ * @param entry Sensor entry.
+ * @return A boolean value indicating whether the channel is selected.
+ *
+ * When the sensor hangs off another multiplexer than the previous one, the previous multiplexer is
+ * disabled first, so sensors with the same address behind different multiplexers never share the bus.
+ */
+bool MS5611MuxArray::select(Entry &entry) {
+    if(entry.mux != selectedMux) {
+        if(selectedMux != NULL) {
+            selectedMux->disable();
+        }
+        selectedMux = entry.mux;
+    }
+    return entry.mux->select(entry.channel);
+}
+
+/**
+ * @brief Runs one conversion phase on all sensors.
+ *
+ * @param temperature True for a D2 phase, false for a D1 phase.
+ */
+void MS5611MuxArray::convert(bool temperature) {
+    if(sensorCount == 0) {
+        return;
+    }
+
+    uint32_t conversionTime = (uint32_t)getConversionTime() * 1000;
+    uint32_t started = 0;
+    bool firstStart = true;
+
+    for(uint8_t position = 0; position < sensorCount; position++) {
+        Entry &entry = entries[position];
+        if(!select(entry)) {
+            continue;
+        }
+        if(temperature) {
+            entry.sensor->startTemperatureConversion();
+        } else {
+            entry.sensor->startPressureConversion();
+        }
+        if(firstStart) {
+            started = micros();
+            firstStart = false;
+        }
+    }
+
+    uint32_t elapsed = micros() - started;
+    if(!firstStart && elapsed < conversionTime) {
+        delayMicroseconds(conversionTime - elapsed);
+    }
+
+    for(uint8_t position = 0; position < sensorCount; position++) {
+        Entry &entry = entries[position];
+        uint32_t raw = select(entry) ? entry.sensor->readConversion() : 0;
+        if(temperature) {
+            entry.temperature = raw;
+        } else {
+            entry.pressure = raw;
+        }
+    }
+}
+
+/**
+ * @brief Retrieves the longest conversion time of all sensors.
+ *
+ * @return The conversion time in milliseconds.
+ */
+uint8_t MS5611MuxArray::getConversionTime(void) {
+    uint8_t conversionTime = 0;
+    for(uint8_t position = 0; position < sensorCount; position++) {
+        uint8_t sensorTime = entries[position].sensor->getConversionTime();
+        if(sensorTime > conversionTime) {
+            conversionTime = sensorTime;
+        }
+    }
+    return conversionTime;
+}
@@ -0,0 +1,70 @@
+#ifndef MS5611Mux_h
+#define MS5611Mux_h
+
+#include "Arduino.h"
+#include "Wire.h"
+#include "MS5611.h"
+
+#define MS5611_MUX_ADDRESS 0x70
+#define MS5611_MUX_CHANNELS 8
+#define MS5611_MUX_NO_CHANNEL 0xFF
+
+#ifndef MS5611_MUX_ARRAY_MAX_SENSORS
+#define MS5611_MUX_ARRAY_MAX_SENSORS 16
+#endif
+
+#define MS5611_MUX_ARRAY_TEMPERATURE_INTERVAL 10
+
+class MS5611Mux {
+public:
+    MS5611Mux(uint8_t address = MS5611_MUX_ADDRESS, TwoWire &wire = Wire);
+    bool select(uint8_t channel);
+    bool disable(void);
+    uint8_t getChannel(void);
+    uint16_t getSwitchCount(void);
+private:
+    TwoWire *wire;
+    uint8_t address;
+    uint8_t channel;
+    uint16_t switchCount;
+
+    bool writeChannelMask(uint8_t mask);
+};
+
+class MS5611MuxArray {
+public:
+    MS5611MuxArray(MS5611Mux &mux);
+    bool add(MS5611 &sensor, uint8_t channel);
+    bool add(MS5611 &sensor, MS5611Mux &mux, uint8_t channel);
+    bool begin(MS5611_osr osr = HIGH_RES);
+    void setTemperatureInterval(uint8_t interval);
+    uint8_t read(bool compensation = false);
+    uint8_t getSensorCount(void);
+    int32_t getPressure(uint8_t index);
+    bool isValid(uint8_t index);
+private:
+    struct Entry {
+        MS5611 *sensor;
+        MS5611Mux *mux;
+        uint8_t channel;
+        uint8_t index;
+        bool valid;
+        uint32_t temperature;
+        uint32_t pressure;
+        int32_t compensatedPressure;
+    };
+
+    MS5611Mux *mux;
+    MS5611Mux *selectedMux;
+    Entry entries[MS5611_MUX_ARRAY_MAX_SENSORS];
+    uint8_t order[MS5611_MUX_ARRAY_MAX_SENSORS];
+    uint8_t sensorCount;
+    uint8_t temperatureInterval;
+    uint8_t temperatureCounter;
+
+    bool select(Entry &entry);
+    void convert(bool temperature);
+    uint8_t getConversionTime(void);
+};
+
+#endif
@@ -0,0 +1,186 @@
+#include "MS5611Packet.h"
+
+MS5611PacketPredictor::MS5611PacketPredictor() {
+    reset();
+}
+
+/**
+ * @brief Clears the sample history used for prediction.
+ */
+void MS5611PacketPredictor::reset(void) {
+    count = 0;
+}
+
+/**
+ * @brief Checks whether enough history exists for a prediction.
+ *
+ * @return True once two samples have been pushed since the last reset.
+ */
+bool MS5611PacketPredictor::canPredict(void) {
+    return count >= 2;
+}
+
+/**
+ * @brief Extrapolates the next sample from the two previous ones.
+ *
+ * @param sample Receives the predicted sample, with the timestamp modulo 2^23.
+ */
+void MS5611PacketPredictor::predict(MS5611Sample &sample) {
+    sample.timestamp = (2 * previous[1].timestamp - previous[0].timestamp) & MS5611_PACKET_TIME_MASK;
+    sample.pressure = 2 * previous[1].pressure - previous[0].pressure;
+    sample.temperature = 2 * previous[1].temperature - previous[0].temperature;
+}
+
+/**
+ * @brief Appends a sample to the prediction history.
+ *
+ * @param sample Sample as it is seen by the decoder, i.e. already reduced to the record ranges.
+ */
+void MS5611PacketPredictor::push(const MS5611Sample &sample) {
+    previous[0] = previous[1];
+    previous[1] = sample;
+    if(count < 2) {
+        count++;
+    }
+}
+
+MS5611PacketEncoder::MS5611PacketEncoder() {
+    begin();
+}
+
+/**
+ * @brief Configures the encoder.
+ *
+ * @param predictive Flag to emit 4-byte delta records between keyframes.
+ * @param keyframeInterval Maximum number of delta records between keyframes, bounding the loss after a dropped record.
+ */
+void MS5611PacketEncoder::begin(bool predictive, uint8_t keyframeInterval) {
+    this->predictive = predictive;
+    this->keyframeInterval = keyframeInterval;
+    reset();
+}
+
+/**
+ * @brief Forces the next record to be a keyframe.
+ */
+void MS5611PacketEncoder::reset(void) {
+    predictor.reset();
+    recordsSinceKeyframe = 0;
+}
+
+/**
+ * @brief Encodes one sample into a record.
+ *
+ * @param sample Sample with timestamp in milliseconds, pressure in Pa and temperature in hundredths of a degree.
+ * @param buffer Output buffer with room for at least MS5611_PACKET_SIZE bytes.
+ * @return The number of bytes written, MS5611_PACKET_SIZE or MS5611_PACKET_DELTA_SIZE.
+ *
+ * This function reduces the sample to the keyframe field ranges first: the timestamp wraps at 2^23 ms,
+ * pressure is clamped to 24 bits and temperature to 16 bits. In predictive mode a delta record is written
+ * when every residual against the predicted sample fits its field and the keyframe interval has not been
+ * reached; otherwise a keyframe is written.
+ */
+uint8_t MS5611PacketEncoder::encode(const MS5611Sample &sample, uint8_t *buffer) {
+    MS5611Sample value;
+    value.timestamp = sample.timestamp & MS5611_PACKET_TIME_MASK;
+    value.pressure = sample.pressure < 0 ? 0 : (sample.pressure > (int32_t)MS5611_PACKET_PRESSURE_MASK ? (int32_t)MS5611_PACKET_PRESSURE_MASK : sample.pressure);
+    value.temperature = sample.temperature < -32768 ? -32768 : (sample.temperature > 32767 ? 32767 : sample.temperature);
+
+    if(predictive && predictor.canPredict() && recordsSinceKeyframe < keyframeInterval) {
+        MS5611Sample predicted;
+        predictor.predict(predicted);
+
+        int32_t timeResidual = (int32_t)(((value.timestamp - predicted.timestamp + 0x400000UL) & MS5611_PACKET_TIME_MASK) - 0x400000UL);
+        int32_t pressureResidual = value.pressure - predicted.pressure;
+        int32_t temperatureResidual = value.temperature - predicted.temperature;
+
+        if(timeResidual >= -64 && timeResidual <= 63
+            && pressureResidual >= -2048 && pressureResidual <= 2047
+            && temperatureResidual >= -2048 && temperatureResidual <= 2047) {
+            uint32_t record = 1
+                | ((uint32_t)(timeResidual & 0x7F) << 1)
+                | ((uint32_t)(pressureResidual & 0xFFF) << 8)
+                | ((uint32_t)(temperatureResidual & 0xFFF) << 20);
+            for(uint8_t index = 0; index < MS5611_PACKET_DELTA_SIZE; index++) {
+                buffer[index] = (uint8_t)(record >> (8 * index));
+            }
+            predictor.push(value);
+            recordsSinceKeyframe++;
+            return MS5611_PACKET_DELTA_SIZE;
+        }
+    }
+
+    uint64_t record = ((uint64_t)value.timestamp << 1)
+        | ((uint64_t)(uint32_t)value.pressure << 24)
+        | ((uint64_t)(uint16_t)value.temperature << 48);
+    for(uint8_t index = 0; index < MS5611_PACKET_SIZE; index++) {
+        buffer[index] = (uint8_t)(record >> (8 * index));
+    }
+    predictor.push(value);
+    recordsSinceKeyframe = 0;
+    return MS5611_PACKET_SIZE;
+}
+
+MS5611PacketDecoder::MS5611PacketDecoder() {
+    reset();
+}
+
+/**
+ * @brief Discards the prediction history, e.g. after a gap in the stream.
+ *
+ * Delta records are rejected until the next two keyframes or one keyframe and its successor arrive.
+ */
+void MS5611PacketDecoder::reset(void) {
+    predictor.reset();
+}
+
+/**
+ * @brief Decodes one record.
+ *
+ * @param buffer Input bytes starting at a record boundary.
+ * @param length Number of bytes available in `buffer`.
+ * @param sample Receives the decoded sample, with the timestamp modulo 2^23 ms.
+ * @return The number of bytes consumed, or 0 if the record is incomplete or a delta record cannot be resolved.
+ */
+uint8_t MS5611PacketDecoder::decode(const uint8_t *buffer, uint8_t length, MS5611Sample &sample) {
+    if(length == 0) {
+        return 0;
+    }
+
+    if((buffer[0] & 0x01) == 0) {
+        if(length < MS5611_PACKET_SIZE) {
+            return 0;
+        }
+        uint64_t record = 0;
+        for(uint8_t index = 0; index < MS5611_PACKET_SIZE; index++) {
+            record |= (uint64_t)buffer[index] << (8 * index);
+        }
+        sample.timestamp = (uint32_t)(record >> 1) & MS5611_PACKET_TIME_MASK;
+        sample.pressure = (int32_t)((record >> 24) & MS5611_PACKET_PRESSURE_MASK);
+        sample.temperature = (int16_t)(uint16_t)(record >> 48);
+        predictor.push(sample);
+        return MS5611_PACKET_SIZE;
+    }
+
+    if(length < MS5611_PACKET_DELTA_SIZE || !predictor.canPredict()) {
+        return 0;
+    }
+    uint32_t record = 0;
+    for(uint8_t index = 0; index < MS5611_PACKET_DELTA_SIZE; index++) {
+        record |= (uint32_t)buffer[index] << (8 * index);
+    }
+    int32_t timeResidual = (int32_t)((record >> 1) & 0x7F);
+    int32_t pressureResidual = (int32_t)((record >> 8) & 0xFFF);
+    int32_t temperatureResidual = (int32_t)((record >> 20) & 0xFFF);
+    timeResidual -= (timeResidual & 0x40) ? 0x80 : 0;
+    pressureResidual -= (pressureResidual & 0x800) ? 0x1000 : 0;
+    temperatureResidual -= (temperatureResidual & 0x800) ? 0x1000 : 0;
+
+    MS5611Sample predicted;
+    predictor.predict(predicted);
+    sample.timestamp = (predicted.timestamp + (uint32_t)timeResidual) & MS5611_PACKET_TIME_MASK;
+    sample.pressure = predicted.pressure + pressureResidual;
+    sample.temperature = predicted.temperature + temperatureResidual;
+    predictor.push(sample);
+    return MS5611_PACKET_DELTA_SIZE;
+}
@@ -0,0 +1,60 @@
+#ifndef MS5611Packet_h
+#define MS5611Packet_h
+
+#include <stdint.h>
+#include "MS5611Sample.h"
+
+#define MS5611_PACKET_SIZE 8
+#define MS5611_PACKET_DELTA_SIZE 4
+#define MS5611_PACKET_KEYFRAME_INTERVAL 16
+#define MS5611_PACKET_TIME_MASK 0x7FFFFFUL
+#define MS5611_PACKET_PRESSURE_MASK 0xFFFFFFUL
+
+/**
+ * Record layouts, little-endian, type in bit 0 of the first byte:
+ *
+ * Keyframe (8 bytes): bit 0 = 0, bits 1-23 timestamp in ms modulo 2^23, bits 24-47 pressure in Pa,
+ * bits 48-63 temperature in hundredths of a degree (signed).
+ *
+ * Delta (4 bytes): bit 0 = 1, bits 1-7 timestamp residual (signed), bits 8-19 pressure residual (signed),
+ * bits 20-31 temperature residual (signed). Residuals are taken against a linear extrapolation of the
+ * two previous samples, so steady trends encode as zeros.
+ *
+ * The format depends only on <stdint.h>, so a ground station or log converter can build MS5611Packet.cpp
+ * without the Arduino core or the driver.
+ */
+class MS5611PacketPredictor {
+public:
+    MS5611PacketPredictor();
+    void reset(void);
+    bool canPredict(void);
+    void predict(MS5611Sample &sample);
+    void push(const MS5611Sample &sample);
+private:
+    MS5611Sample previous[2];
+    uint8_t count;
+};
+
+class MS5611PacketEncoder {
+public:
+    MS5611PacketEncoder();
+    void begin(bool predictive = false, uint8_t keyframeInterval = MS5611_PACKET_KEYFRAME_INTERVAL);
+    void reset(void);
+    uint8_t encode(const MS5611Sample &sample, uint8_t *buffer);
+private:
+    MS5611PacketPredictor predictor;
+    bool predictive;
+    uint8_t keyframeInterval;
+    uint8_t recordsSinceKeyframe;
+};
+
+class MS5611PacketDecoder {
+public:
+    MS5611PacketDecoder();
+    void reset(void);
+    uint8_t decode(const uint8_t *buffer, uint8_t length, MS5611Sample &sample);
+private:
+    MS5611PacketPredictor predictor;
+};
+
+#endif
@@ -0,0 +1,34 @@
+#include "MS5611Planner.h"
+
+/**
+ * @brief Checks a requested sensor array configuration against the bus model.
+ *
+ * @param busClock I2C clock in Hz.
+ * @param sensors Number of sensors sampled in each cycle.
+ * @param osr Oversampling rate of the sensors.
+ * @param temperatureInterval Number of pressure samples per temperature refresh.
+ * @param rate Requested pressure rate per sensor in millihertz.
+ * @param channels Number of multiplexer channels in use, 0 without a multiplexer.
+ * @param log Optional output that receives a warning when the configuration is not achievable.
+ * @return A boolean value indicating whether the requested rate is achievable.
+ *
+ * This function compares the requested rate with `getMaximumRate`. When it is exceeded and a log output
+ * is given, it prints the achievable rate and the bus utilization the request would need.
+ */
+bool MS5611Planner::checkConfiguration(uint32_t busClock, uint8_t sensors, MS5611_osr osr, uint8_t temperatureInterval, uint32_t rate, uint8_t channels, Print *log) {
+    uint32_t maximumRate = getMaximumRate(busClock, sensors, osr, temperatureInterval, channels);
+    if(rate <= maximumRate) {
+        return true;
+    }
+
+    if(log != NULL) {
+        log->print("MS5611: requested ");
+        log->print(rate);
+        log->print(" mHz per sensor exceeds maximum of ");
+        log->print(maximumRate);
+        log->print(" mHz, bus utilization would be ");
+        log->print(getBusUtilization(busClock, sensors, temperatureInterval, rate, channels));
+        log->println(" permille");
+    }
+    return false;
+}
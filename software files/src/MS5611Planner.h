@@ -0,0 +1,70 @@
+#ifndef MS5611Planner_h
+#define MS5611Planner_h
+
+#include "Arduino.h"
+#include "MS5611.h"
+
+#define MS5611_PLANNER_BITS_PER_BYTE 9
+#define MS5611_PLANNER_FRAME_BITS 2
+#define MS5611_PLANNER_START_BITS (2 * MS5611_PLANNER_BITS_PER_BYTE + MS5611_PLANNER_FRAME_BITS)
+#define MS5611_PLANNER_READ_BITS (6 * MS5611_PLANNER_BITS_PER_BYTE + 2 * MS5611_PLANNER_FRAME_BITS)
+#define MS5611_PLANNER_SWITCH_BITS (2 * MS5611_PLANNER_BITS_PER_BYTE + MS5611_PLANNER_FRAME_BITS)
+
+/**
+ * Bus bandwidth model for sensor arrays that convert concurrently, as MS5611Group and MS5611MuxArray do.
+ *
+ * One conversion costs a command write (address and command byte) and a result read (address and
+ * register byte, then address and three data bytes), each byte taking nine clock periods plus a start
+ * and stop per transaction. A phase starts one conversion per sensor, waits for the conversion time
+ * used by MS5611::setOversampling counted from the end of the first start, so the other starts overlap
+ * the wait, and reads every result. A pressure sample needs one D1 phase and one D2 phase every
+ * `temperatureInterval` samples. Behind a multiplexer, every used channel is switched once before the
+ * starts and once before the reads of a phase; with several multiplexers, count each one after the
+ * first as one more channel for the disable it needs. Rates are in millihertz, utilization in permille.
+ */
+class MS5611Planner {
+public:
+    static constexpr uint32_t getConversionTime(MS5611_osr osr) {
+        return osr == ULTRA_HIGH_RES ? 10000UL :
+               osr == HIGH_RES ? 5000UL :
+               osr == STANDARD ? 3000UL :
+               osr == LOW_POWER ? 2000UL : 1000UL;
+    }
+
+    static constexpr uint32_t getBusTime(uint32_t busClock, uint32_t bits) {
+        return (uint32_t)(((uint64_t)bits * 1000000UL + busClock - 1) / busClock);
+    }
+
+    static constexpr uint32_t getPhaseTime(uint32_t busClock, uint8_t sensors, MS5611_osr osr, uint8_t channels = 0) {
+        return (sensors > 0 ? getBusTime(busClock, MS5611_PLANNER_START_BITS + (channels > 0 ? MS5611_PLANNER_SWITCH_BITS : 0)) : 0)
+            + max32(getConversionTime(osr), getBusTime(busClock, (uint32_t)(sensors > 0 ? sensors - 1 : 0) * MS5611_PLANNER_START_BITS
+                + (uint32_t)(channels > 0 ? channels - 1 : 0) * MS5611_PLANNER_SWITCH_BITS))
+            + getBusTime(busClock, (uint32_t)sensors * MS5611_PLANNER_READ_BITS + (uint32_t)channels * MS5611_PLANNER_SWITCH_BITS);
+    }
+
+    static constexpr uint32_t getMaximumRate(uint32_t busClock, uint8_t sensors, MS5611_osr osr, uint8_t temperatureInterval, uint8_t channels = 0) {
+        return (uint32_t)(1000000000ULL * interval(temperatureInterval)
+            / ((uint64_t)getPhaseTime(busClock, sensors, osr, channels) * (interval(temperatureInterval) + 1)));
+    }
+
+    static constexpr uint32_t getBusUtilization(uint32_t busClock, uint8_t sensors, uint8_t temperatureInterval, uint32_t rate, uint8_t channels = 0) {
+        return (uint32_t)((uint64_t)rate * ((uint32_t)sensors * (MS5611_PLANNER_START_BITS + MS5611_PLANNER_READ_BITS) + (uint32_t)channels * 2 * MS5611_PLANNER_SWITCH_BITS)
+            * (interval(temperatureInterval) + 1) / interval(temperatureInterval) / busClock);
+    }
+
+    static constexpr bool isFeasible(uint32_t busClock, uint8_t sensors, MS5611_osr osr, uint8_t temperatureInterval, uint32_t rate, uint8_t channels = 0) {
+        return rate <= getMaximumRate(busClock, sensors, osr, temperatureInterval, channels);
+    }
+
+    static bool checkConfiguration(uint32_t busClock, uint8_t sensors, MS5611_osr osr, uint8_t temperatureInterval, uint32_t rate, uint8_t channels = 0, Print *log = NULL);
+private:
+    static constexpr uint32_t max32(uint32_t a, uint32_t b) {
+        return a > b ? a : b;
+    }
+
+    static constexpr uint64_t interval(uint8_t temperatureInterval) {
+        return temperatureInterval > 0 ? temperatureInterval : 1;
+    }
+};
+
+#endif
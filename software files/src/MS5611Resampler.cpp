@@ -0,0 +1,148 @@
+#include "MS5611Resampler.h"
+
+MS5611Resampler::MS5611Resampler() {
+    period = 5000;
+    mode = LINEAR_INTERPOLATION;
+    reset();
+}
+
+/**
+ * @brief Configures the output timeline of the resampler.
+ *
+ * @param period Output sample period in microseconds (5000 for 200 Hz).
+ * @param mode Interpolation used between input samples.
+ *
+ * This function sets the fixed output period and the interpolation mode, then clears the sample
+ * history. Linear interpolation delays the output by at most one input interval; cubic interpolation
+ * needs one more input sample ahead of the output time and therefore delays it by at most two.
+ */
+void MS5611Resampler::begin(uint32_t period, MS5611_interpolation mode) {
+    this->period = period > 0 ? period : 1;
+    this->mode = mode;
+    reset();
+}
+
+/**
+ * @brief Clears the sample history.
+ *
+ * This function discards every buffered input sample. The output timeline restarts at the timestamp
+ * of the next sample passed to `push`.
+ */
+void MS5611Resampler::reset(void) {
+    sampleCount = 0;
+    nextTime = 0;
+}
+
+/**
+ * @brief Adds an irregularly timed input sample.
+ *
+ * @param timestamp Time of the sample in microseconds, typically taken from micros().
+ * @param value Sample value, e.g. compensated pressure in Pa or altitude in cm.
+ *
+ * This function shifts the new sample into the fixed size history. Samples whose timestamp does not
+ * advance past the newest buffered sample are ignored, as they cannot be placed on the timeline.
+ * The first sample after a reset also anchors the output timeline.
+ */
+void MS5611Resampler::push(uint32_t timestamp, int32_t value) {
+    if(sampleCount > 0 && (int32_t)(timestamp - sampleTime[MS5611_RESAMPLER_HISTORY - 1]) <= 0) {
+        return;
+    }
+    if(sampleCount == 0) {
+        nextTime = timestamp;
+    }
+
+    for(uint8_t index = 1; index < MS5611_RESAMPLER_HISTORY; index++) {
+        sampleTime[index - 1] = sampleTime[index];
+        sampleValue[index - 1] = sampleValue[index];
+    }
+    sampleTime[MS5611_RESAMPLER_HISTORY - 1] = timestamp;
+    sampleValue[MS5611_RESAMPLER_HISTORY - 1] = value;
+
+    if(sampleCount < MS5611_RESAMPLER_HISTORY) {
+        sampleCount++;
+    }
+}
+
+/**
+ * @brief Retrieves the next sample on the fixed-rate timeline.
+ *
+ * @param timestamp Receives the output time in microseconds.
+ * @param value Receives the interpolated value.
+ * @return True if a sample was produced, false if more input is needed.
+ *
+ * This function interpolates the buffered input at the next output time once the input brackets it.
+ * Output times are always multiples of the period from the timeline anchor. If the input has moved
+ * past output times that can no longer be bracketed, those times are skipped rather than extrapolated.
+ * Call it repeatedly after each `push` until it returns false.
+ */
+bool MS5611Resampler::read(uint32_t &timestamp, int32_t &value) {
+    uint8_t required = (mode == CUBIC_INTERPOLATION) ? 4 : 2;
+    if(sampleCount < required) {
+        return false;
+    }
+
+    uint8_t first = (mode == CUBIC_INTERPOLATION) ? 1 : 2;
+    uint32_t startTime = sampleTime[first];
+    uint32_t endTime = sampleTime[first + 1];
+
+    if((int32_t)(nextTime - startTime) < 0) {
+        uint32_t gap = startTime - nextTime;
+        nextTime += ((gap + period - 1) / period) * period;
+    }
+    if((int32_t)(nextTime - endTime) > 0) {
+        return false;
+    }
+
+    timestamp = nextTime;
+    value = (mode == CUBIC_INTERPOLATION) ? interpolateCubic(nextTime) : interpolateLinear(nextTime);
+    nextTime += period;
+    return true;
+}
+
+/**
+ * @brief Retrieves the configured output period.
+ *
+ * @return The output period in microseconds.
+ */
+uint32_t MS5611Resampler::getPeriod(void) {
+    return period;
+}
+
+/**
+ * @brief Interpolates linearly between the two newest samples.
+ *
+ * @param time Output time in microseconds, inside the newest input interval.
+ * @return The interpolated value.
+ */
+int32_t MS5611Resampler::interpolateLinear(uint32_t time) {
+    uint32_t span = sampleTime[3] - sampleTime[2];
+    int64_t delta = (int64_t)sampleValue[3] - sampleValue[2];
+    return sampleValue[2] + (int32_t)(delta * (int64_t)(time - sampleTime[2]) / (int64_t)span);
+}
+
+/**
+ * @brief Interpolates with a cubic Hermite spline over the middle input interval.
+ *
+ * @param time Output time in microseconds, between the second and third buffered samples.
+ * @return The interpolated value.
+ *
+ * This function evaluates a cubic Hermite segment whose tangents are the finite differences across
+ * the neighbouring samples, which keeps it valid for non-uniform input spacing. The position within
+ * the interval is held in Q16 fixed point so no floating point arithmetic is needed.
+ */
+int32_t MS5611Resampler::interpolateCubic(uint32_t time) {
+    int64_t span = (int64_t)(sampleTime[2] - sampleTime[1]);
+    int64_t tangentStart = ((int64_t)sampleValue[2] - sampleValue[0]) * span / (int64_t)(sampleTime[2] - sampleTime[0]);
+    int64_t tangentEnd = ((int64_t)sampleValue[3] - sampleValue[1]) * span / (int64_t)(sampleTime[3] - sampleTime[1]);
+    int64_t delta = (int64_t)sampleValue[2] - sampleValue[1];
+
+    int64_t s = (int64_t)(time - sampleTime[1]) * 65536 / span;
+    int64_t s2 = s * s / 65536;
+    int64_t s3 = s2 * s / 65536;
+
+    int64_t h10 = s3 - 2 * s2 + s;
+    int64_t h01 = -2 * s3 + 3 * s2;
+    int64_t h11 = s3 - s2;
+
+    return sampleValue[1] + (int32_t)((h10 * tangentStart + h01 * delta + h11 * tangentEnd) / 65536);
+}
@@ -0,0 +1,41 @@
+#ifndef MS5611Resampler_h
+#define MS5611Resampler_h
+
+#include "Arduino.h"
+
+#define MS5611_RESAMPLER_HISTORY 4
+
+    enum MS5611_interpolation {
+        LINEAR_INTERPOLATION = 0,
+        CUBIC_INTERPOLATION  = 1
+    };
+
+/**
+ * Resamples irregularly timed readings onto a fixed-rate timeline.
+ *
+ * All timestamps and the period are in microseconds, wrapping like micros(), which is the expected
+ * source: push each reading with micros() taken when it arrived. MS5611Sample timestamps, as produced
+ * by MS5611Scheduler and MS5611Dispatcher, are in milliseconds and too coarse for output rates of
+ * 100 Hz and more, so subscribers should stamp the sample with micros() instead of converting them.
+ */
+class MS5611Resampler {
+public:
+    MS5611Resampler();
+    void begin(uint32_t period, MS5611_interpolation mode = LINEAR_INTERPOLATION);
+    void reset(void);
+    void push(uint32_t timestamp, int32_t value);
+    bool read(uint32_t &timestamp, int32_t &value);
+    uint32_t getPeriod(void);
+private:
+    uint32_t sampleTime[MS5611_RESAMPLER_HISTORY];
+    int32_t sampleValue[MS5611_RESAMPLER_HISTORY];
+    uint8_t sampleCount;
+    uint32_t period;
+    uint32_t nextTime;
+    MS5611_interpolation mode;
+
+    int32_t interpolateLinear(uint32_t time);
+    int32_t interpolateCubic(uint32_t time);
+};
+
+#endif
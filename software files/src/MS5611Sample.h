@@ -0,0 +1,12 @@
+#ifndef MS5611Sample_h
+#define MS5611Sample_h
+
+#include <stdint.h>
+
+struct MS5611Sample {
+    uint32_t timestamp;
+    int32_t pressure;
+    int32_t temperature;
+};
+
+#endif
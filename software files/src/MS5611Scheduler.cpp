@@ -0,0 +1,266 @@
+#include "MS5611Scheduler.h"
+
+/**
+ * @brief Creates a scheduler for one initialized sensor.
+ *
+ * @param sensor Sensor whose conversions the scheduler owns. Do not read it directly while scheduling.
+ */
+MS5611Scheduler::MS5611Scheduler(MS5611 &sensor) {
+    this->sensor = &sensor;
+    dispatcher = NULL;
+    dispatchStreams = 0;
+    seaLevelPressure = 101325;
+    compensation = false;
+    begin(0, 0, 0);
+}
+
+/**
+ * @brief Configures the output streams and restarts the schedule.
+ *
+ * @param pressurePeriod Pressure output period in microseconds, 0 to disable.
+ * @param altitudePeriod Altitude output period in microseconds, 0 to disable. The altitude stream is never
+ * emitted when built with MS5611_NO_ALTITUDE.
+ * @param temperaturePeriod Temperature output period in microseconds, 0 to disable.
+ * @param compensationAge Maximum age of the temperature used to compensate pressure in microseconds.
+ * 0 takes a fresh temperature before every pressure conversion.
+ *
+ * This function plans the conversion sequence. Pressure and altitude share D1 conversions, which run at
+ * the shorter of their two periods. D2 conversions run at the temperature period, or more often when
+ * pressure compensation needs a fresher temperature. No other conversions are made.
+ */
+void MS5611Scheduler::begin(uint32_t pressurePeriod, uint32_t altitudePeriod, uint32_t temperaturePeriod, uint32_t compensationAge) {
+    this->pressurePeriod = pressurePeriod;
+    this->altitudePeriod = altitudePeriod;
+    this->temperaturePeriod = temperaturePeriod;
+
+    pressureConversionPeriod = pressurePeriod;
+    if(altitudePeriod > 0 && (pressureConversionPeriod == 0 || altitudePeriod < pressureConversionPeriod)) {
+        pressureConversionPeriod = altitudePeriod;
+    }
+    temperatureConversionPeriod = temperaturePeriod;
+    if(compensationAge == 0) {
+        compensationAge = pressureConversionPeriod;
+    }
+    if(pressureConversionPeriod > 0 && (temperatureConversionPeriod == 0 || compensationAge < temperatureConversionPeriod)) {
+        temperatureConversionPeriod = compensationAge;
+    }
+
+    uint32_t now = micros();
+    clockMicros = now;
+    clockMillis = millis();
+    clockRemainder = 0;
+    conversionMillis = clockMillis;
+    state = IDLE;
+    temperature = 0;
+    conversionCount = 0;
+    altitude = 0;
+    sample.timestamp = clockMillis;
+    sample.pressure = 0;
+    sample.temperature = 0;
+    nextPressureConversion = now;
+    nextTemperatureConversion = now;
+    nextPressure = now;
+    nextAltitude = now;
+    nextTemperature = now;
+}
+
+/**
+ * @brief Sets whether second order compensation is applied to the outputs.
+ *
+ * @param compensation Flag to enable second order compensation.
+ */
+void MS5611Scheduler::setCompensation(bool compensation) {
+    this->compensation = compensation;
+}
+
+/**
+ * @brief Sets the reference pressure for the altitude stream.
+ *
+ * @param seaLevelPressure Sea level pressure in Pa.
+ */
+void MS5611Scheduler::setSeaLevelPressure(int32_t seaLevelPressure) {
+    this->seaLevelPressure = seaLevelPressure;
+}
+
+/**
+ * @brief Attaches a dispatcher that receives every new sample.
+ *
+ * @param dispatcher Dispatcher to publish to, or NULL to detach.
+ * @param streams Bitmask of MS5611_STREAM_* values; the sample is published when any of them is emitted.
+ *
+ * Consumers subscribed to the dispatcher share the scheduler's single conversion sequence instead of
+ * each reading the sensor.
+ */
+void MS5611Scheduler::setDispatcher(MS5611Dispatcher *dispatcher, uint8_t streams) {
+    this->dispatcher = dispatcher;
+    dispatchStreams = streams;
+}
+
+/**
+ * @brief Advances the schedule using the current time.
+ *
+ * @return A bitmask of MS5611_STREAM_* values that have a new output.
+ */
+uint8_t MS5611Scheduler::update(void) {
+    return update(micros());
+}
+
+/**
+ * @brief Advances the schedule.
+ *
+ * @param now Current time in microseconds.
+ * @return A bitmask of MS5611_STREAM_* values that have a new output.
+ *
+ * This function never blocks. It collects a finished conversion, emits the streams that are due with it,
+ * publishes the sample to an attached dispatcher and starts the next conversion that is due, temperature
+ * first. Call it from the main loop at least as often as the shortest output period.
+ */
+uint8_t MS5611Scheduler::update(uint32_t now) {
+    uint8_t emitted = 0;
+    tick(now);
+
+    if(state != IDLE) {
+        if((uint32_t)(now - conversionStart) < (uint32_t)sensor->getConversionTime() * 1000) {
+            return 0;
+        }
+        emitted = complete(now);
+        if(dispatcher != NULL && (emitted & dispatchStreams) != 0) {
+            dispatcher->publish(sample);
+        }
+    }
+
+    if(temperatureConversionPeriod > 0 && (temperature == 0 || isDue(now, nextTemperatureConversion))) {
+        sensor->startTemperatureConversion();
+        conversionSlot = nextTemperatureConversion;
+        nextTemperatureConversion = advance(nextTemperatureConversion, temperatureConversionPeriod, now);
+        conversionStart = now;
+        conversionMillis = clockMillis;
+        state = CONVERTING_TEMPERATURE;
+    } else if(pressureConversionPeriod > 0 && isDue(now, nextPressureConversion)) {
+        sensor->startPressureConversion();
+        conversionSlot = nextPressureConversion;
+        nextPressureConversion = advance(nextPressureConversion, pressureConversionPeriod, now);
+        conversionStart = now;
+        conversionMillis = clockMillis;
+        state = CONVERTING_PRESSURE;
+    }
+
+    return emitted;
+}
+
+/**
+ * @brief Retrieves the latest outputs.
+ *
+ * @return The latest sample, with the timestamp in milliseconds of the start of the conversion that
+ * produced it, on the millis() time base like every MS5611Sample. Pressure is in Pa and temperature in
+ * hundredths of a degree Celsius.
+ */
+const MS5611Sample &MS5611Scheduler::getSample(void) {
+    return sample;
+}
+
+/**
+ * @brief Retrieves the latest altitude output.
+ *
+ * @return The altitude in centimetres relative to the configured sea level pressure.
+ */
+int32_t MS5611Scheduler::getAltitude(void) {
+    return altitude;
+}
+
+/**
+ * @brief Retrieves the number of conversions made since `begin`.
+ *
+ * @return The conversion count.
+ */
+uint32_t MS5611Scheduler::getConversionCount(void) {
+    return conversionCount;
+}
+
+/**
+ * @brief Advances the millisecond clock used for sample timestamps.
+ *
+ * @param now Current time in microseconds.
+ *
+ * The clock starts at millis() in `begin` and follows the microsecond times passed to `update`, carrying
+ * the sub-millisecond remainder, so timestamps stay continuous across the micros() wrap.
+ */
+void MS5611Scheduler::tick(uint32_t now) {
+    uint32_t elapsed = now - clockMicros;
+    clockMicros = now;
+    clockMillis += elapsed / 1000;
+    clockRemainder += elapsed % 1000;
+    if(clockRemainder >= 1000) {
+        clockMillis++;
+        clockRemainder -= 1000;
+    }
+}
+
+/**
+ * @brief Checks whether a deadline has been reached, tolerating timer wrap-around.
+ */
+bool MS5611Scheduler::isDue(uint32_t now, uint32_t deadline) {
+    return (int32_t)(now - deadline) >= 0;
+}
+
+/**
+ * @brief Moves a deadline to the next period, skipping periods that were missed entirely.
+ */
+uint32_t MS5611Scheduler::advance(uint32_t deadline, uint32_t period, uint32_t now) {
+    deadline += period;
+    if(isDue(now, deadline)) {
+        deadline = now + period;
+    }
+    return deadline;
+}
+
+/**
+ * @brief Collects the running conversion and emits the streams that are due.
+ *
+ * @param now Current time in microseconds.
+ * @return A bitmask of MS5611_STREAM_* values that have a new output.
+ *
+ * Streams are matched against the scheduled slot of the conversion rather than the time it finished,
+ * so a stream whose period is a multiple of the conversion period is emitted on exactly every n-th
+ * conversion.
+ */
+uint8_t MS5611Scheduler::complete(uint32_t now) {
+    State finished = state;
+    uint32_t raw = sensor->readConversion();
+    conversionCount++;
+    state = IDLE;
+
+    if(raw == 0) {
+        if(finished == CONVERTING_TEMPERATURE) {
+            nextTemperatureConversion = now;
+        }
+        return 0;
+    }
+
+    uint8_t emitted = 0;
+    if(finished == CONVERTING_TEMPERATURE) {
+        temperature = raw;
+        sample.temperature = sensor->compensateTemperature(raw, compensation);
+        if(temperaturePeriod > 0 && isDue(conversionSlot, nextTemperature)) {
+            sample.timestamp = conversionMillis;
+            nextTemperature = advance(nextTemperature, temperaturePeriod, conversionSlot);
+            emitted |= MS5611_STREAM_TEMPERATURE;
+        }
+        return emitted;
+    }
+
+    sample.pressure = sensor->compensatePressure(raw, temperature, compensation);
+    sample.timestamp = conversionMillis;
+    if(pressurePeriod > 0 && isDue(conversionSlot, nextPressure)) {
+        nextPressure = advance(nextPressure, pressurePeriod, conversionSlot);
+        emitted |= MS5611_STREAM_PRESSURE;
+    }
+#ifndef MS5611_NO_ALTITUDE
+    if(altitudePeriod > 0 && isDue(conversionSlot, nextAltitude)) {
+        altitude = (int32_t)(sensor->getAltitude(sample.pressure, seaLevelPressure) * 100);
+        nextAltitude = advance(nextAltitude, altitudePeriod, conversionSlot);
+        emitted |= MS5611_STREAM_ALTITUDE;
+    }
+#endif
+    return emitted;
+}
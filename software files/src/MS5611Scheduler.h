@@ -0,0 +1,68 @@
+#ifndef MS5611Scheduler_h
+#define MS5611Scheduler_h
+
+#include "Arduino.h"
+#include "MS5611.h"
+#include "MS5611Dispatcher.h"
+
+#define MS5611_STREAM_PRESSURE 0x01
+#define MS5611_STREAM_ALTITUDE 0x02
+#define MS5611_STREAM_TEMPERATURE 0x04
+
+#define MS5611_SCHEDULER_COMPENSATION_AGE 1000000UL
+
+class MS5611Scheduler {
+public:
+    MS5611Scheduler(MS5611 &sensor);
+    void begin(uint32_t pressurePeriod, uint32_t altitudePeriod, uint32_t temperaturePeriod, uint32_t compensationAge = MS5611_SCHEDULER_COMPENSATION_AGE);
+    void setCompensation(bool compensation);
+    void setSeaLevelPressure(int32_t seaLevelPressure);
+    void setDispatcher(MS5611Dispatcher *dispatcher, uint8_t streams = MS5611_STREAM_PRESSURE);
+    uint8_t update(void);
+    uint8_t update(uint32_t now);
+    const MS5611Sample &getSample(void);
+    int32_t getAltitude(void);
+    uint32_t getConversionCount(void);
+private:
+    enum State {
+        IDLE,
+        CONVERTING_PRESSURE,
+        CONVERTING_TEMPERATURE
+    };
+
+    MS5611 *sensor;
+    MS5611Dispatcher *dispatcher;
+    uint8_t dispatchStreams;
+    MS5611Sample sample;
+    int32_t altitude;
+    int32_t seaLevelPressure;
+    bool compensation;
+    State state;
+    uint32_t conversionStart;
+    uint32_t conversionMillis;
+    uint32_t clockMicros;
+    uint32_t clockMillis;
+    uint16_t clockRemainder;
+    uint32_t conversionSlot;
+    uint32_t temperature;
+    uint32_t conversionCount;
+
+    uint32_t pressurePeriod;
+    uint32_t altitudePeriod;
+    uint32_t temperaturePeriod;
+    uint32_t pressureConversionPeriod;
+    uint32_t temperatureConversionPeriod;
+
+    uint32_t nextPressureConversion;
+    uint32_t nextTemperatureConversion;
+    uint32_t nextPressure;
+    uint32_t nextAltitude;
+    uint32_t nextTemperature;
+
+    static bool isDue(uint32_t now, uint32_t deadline);
+    static uint32_t advance(uint32_t deadline, uint32_t period, uint32_t now);
+    uint8_t complete(uint32_t now);
+    void tick(uint32_t now);
+};
+
+#endif
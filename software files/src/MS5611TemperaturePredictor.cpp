@@ -0,0 +1,195 @@
+#include "MS5611TemperaturePredictor.h"
+
+/**
+ * @brief Creates a temperature predictor for one initialized sensor.
+ *
+ * @param sensor Sensor whose calibration coefficients define the pressure sensitivity to temperature.
+ */
+MS5611TemperaturePredictor::MS5611TemperaturePredictor(MS5611 &sensor) {
+    this->sensor = &sensor;
+    begin();
+}
+
+/**
+ * @brief Configures when a fresh temperature conversion is required.
+ *
+ * @param errorBound Maximum predicted pressure error in Pa caused by an extrapolated temperature.
+ * @param maximumAge Maximum time in milliseconds between temperature conversions regardless of prediction.
+ */
+void MS5611TemperaturePredictor::begin(int32_t errorBound, uint32_t maximumAge) {
+    this->errorBound = errorBound;
+    this->maximumAge = maximumAge;
+    reset();
+}
+
+/**
+ * @brief Discards the temperature history and the conversion counters.
+ */
+void MS5611TemperaturePredictor::reset(void) {
+    historyCount = 0;
+    pressureCount = 0;
+    temperatureCount = 0;
+}
+
+/**
+ * @brief Adds a measured raw temperature to the history.
+ *
+ * @param timestamp Time of the conversion in milliseconds.
+ * @param D2 Raw temperature value. A value of 0 (no answer) is ignored.
+ */
+void MS5611TemperaturePredictor::addTemperature(uint32_t timestamp, uint32_t D2) {
+    if(D2 == 0) {
+        return;
+    }
+    if(historyCount > 0 && timestamp == historyTime[historyCount - 1]) {
+        history[historyCount - 1] = D2;
+        return;
+    }
+    if(historyCount == 3) {
+        history[0] = history[1];
+        historyTime[0] = historyTime[1];
+        history[1] = history[2];
+        historyTime[1] = historyTime[2];
+        historyCount = 2;
+    }
+    history[historyCount] = D2;
+    historyTime[historyCount] = timestamp;
+    historyCount++;
+}
+
+/**
+ * @brief Extrapolates the raw temperature linearly from the two newest measurements.
+ *
+ * @param timestamp Time in milliseconds to predict for.
+ * @return The predicted raw temperature, or 0 if no temperature was measured yet.
+ */
+uint32_t MS5611TemperaturePredictor::predict(uint32_t timestamp) {
+    if(historyCount == 0) {
+        return 0;
+    }
+    uint32_t latest = history[historyCount - 1];
+    if(historyCount < 2) {
+        return latest;
+    }
+    int64_t elapsed = (int64_t)(timestamp - historyTime[historyCount - 1]);
+    int64_t predicted = (int64_t)latest + getSlope(historyCount - 1) * elapsed / 65536;
+    if(predicted < 1) {
+        predicted = 1;
+    }
+    return predicted > 0xFFFFFF ? 0xFFFFFF : (uint32_t)predicted;
+}
+
+/**
+ * @brief Estimates the pressure error an extrapolated temperature would cause.
+ *
+ * @param timestamp Time in milliseconds to predict for.
+ * @param D1 Raw pressure value the temperature would be used with.
+ * @return The estimated pressure error in Pa, or INT32_MAX if too little history exists.
+ *
+ * The raw temperature error is estimated as the change between the last two measured slopes multiplied
+ * by the time since the newest measurement, i.e. how far off the extrapolation would have gone had the
+ * trend bent as much as it did last time. It is converted to pressure by compensating D1 with the
+ * predicted temperature moved by that error in either direction, using the sensor's own first order
+ * formulas, so the estimate is right for every part of the MS56xx family.
+ */
+int32_t MS5611TemperaturePredictor::getPredictedError(uint32_t timestamp, uint32_t D1) {
+    if(historyCount < 3) {
+        return INT32_MAX;
+    }
+    int64_t slopeChange = getSlope(2) - getSlope(1);
+    if(slopeChange < 0) {
+        slopeChange = -slopeChange;
+    }
+    int64_t elapsed = (int64_t)(timestamp - historyTime[2]);
+    int64_t temperatureError = slopeChange * elapsed / 65536 + 1;
+    if(temperatureError > 0xFFFFFF) {
+        temperatureError = 0xFFFFFF;
+    }
+
+    int64_t predicted = predict(timestamp);
+    int64_t low = predicted - temperatureError < 1 ? 1 : predicted - temperatureError;
+    int64_t high = predicted + temperatureError > 0xFFFFFF ? 0xFFFFFF : predicted + temperatureError;
+    int32_t pressure = sensor->compensatePressure(D1, (uint32_t)predicted);
+    int64_t lowError = (int64_t)sensor->compensatePressure(D1, (uint32_t)low) - pressure;
+    int64_t highError = (int64_t)sensor->compensatePressure(D1, (uint32_t)high) - pressure;
+    if(lowError < 0) {
+        lowError = -lowError;
+    }
+    if(highError < 0) {
+        highError = -highError;
+    }
+    int64_t error = lowError > highError ? lowError : highError;
+    return error > INT32_MAX ? INT32_MAX : (int32_t)error;
+}
+
+/**
+ * @brief Decides whether a fresh temperature conversion is needed.
+ *
+ * @param timestamp Current time in milliseconds.
+ * @param D1 Raw pressure value that is about to be compensated.
+ * @return True if the predicted error exceeds the bound or the newest temperature is older than the maximum age.
+ */
+bool MS5611TemperaturePredictor::needsTemperature(uint32_t timestamp, uint32_t D1) {
+    if(historyCount == 0 || (uint32_t)(timestamp - historyTime[historyCount - 1]) >= maximumAge) {
+        return true;
+    }
+    return getPredictedError(timestamp, D1) > errorBound;
+}
+
+/**
+ * @brief Reads the pressure, converting temperature only when the prediction is not good enough.
+ *
+ * @param compensation Flag to enable second order pressure compensation.
+ * @return The pressure in Pa, or 0 if the sensor did not answer.
+ */
+int32_t MS5611TemperaturePredictor::readPressure(bool compensation) {
+    uint32_t D1 = sensor->readRawPressure();
+    if(D1 == 0) {
+        return 0;
+    }
+    pressureCount++;
+
+    uint32_t timestamp = millis();
+    if(needsTemperature(timestamp, D1)) {
+        addTemperature(timestamp, sensor->readRawTemperature());
+        temperatureCount++;
+    }
+
+    uint32_t D2 = predict(timestamp);
+    if(D2 == 0) {
+        return 0;
+    }
+    return sensor->compensatePressure(D1, D2, compensation);
+}
+
+/**
+ * @brief Retrieves the number of pressure conversions made by `readPressure`.
+ *
+ * @return The pressure conversion count since the last reset.
+ */
+uint32_t MS5611TemperaturePredictor::getPressureCount(void) {
+    return pressureCount;
+}
+
+/**
+ * @brief Retrieves the number of temperature conversions made by `readPressure`.
+ *
+ * @return The temperature conversion count since the last reset.
+ */
+uint32_t MS5611TemperaturePredictor::getTemperatureCount(void) {
+    return temperatureCount;
+}
+
+/**
+ * @brief Calculates the slope between a history entry and its predecessor.
+ *
+ * @param index History index, at least 1.
+ * @return The slope in raw temperature counts per millisecond in Q16 fixed point.
+ */
+int64_t MS5611TemperaturePredictor::getSlope(uint8_t index) {
+    int64_t elapsed = (int64_t)(historyTime[index] - historyTime[index - 1]);
+    if(elapsed <= 0) {
+        return 0;
+    }
+    return ((int64_t)history[index] - history[index - 1]) * 65536 / elapsed;
+}
@@ -0,0 +1,35 @@
+#ifndef MS5611TemperaturePredictor_h
+#define MS5611TemperaturePredictor_h
+
+#include "Arduino.h"
+#include "MS5611.h"
+
+#define MS5611_PREDICTOR_ERROR_BOUND 2
+#define MS5611_PREDICTOR_MAXIMUM_AGE 60000
+
+class MS5611TemperaturePredictor {
+public:
+    MS5611TemperaturePredictor(MS5611 &sensor);
+    void begin(int32_t errorBound = MS5611_PREDICTOR_ERROR_BOUND, uint32_t maximumAge = MS5611_PREDICTOR_MAXIMUM_AGE);
+    void reset(void);
+    void addTemperature(uint32_t timestamp, uint32_t D2);
+    uint32_t predict(uint32_t timestamp);
+    int32_t getPredictedError(uint32_t timestamp, uint32_t D1);
+    bool needsTemperature(uint32_t timestamp, uint32_t D1);
+    int32_t readPressure(bool compensation = false);
+    uint32_t getPressureCount(void);
+    uint32_t getTemperatureCount(void);
+private:
+    MS5611 *sensor;
+    uint32_t history[3];
+    uint32_t historyTime[3];
+    uint8_t historyCount;
+    int32_t errorBound;
+    uint32_t maximumAge;
+    uint32_t pressureCount;
+    uint32_t temperatureCount;
+
+    int64_t getSlope(uint8_t index);
+};
+
+#endif
@@ -0,0 +1,164 @@
+#ifndef MS5611Tendency_h
+#define MS5611Tendency_h
+
+#include "Arduino.h"
+#include "MS5611.h"
+
+#define MS5611_TENDENCY_WINDOW 10800000UL
+#define MS5611_TENDENCY_STEADY 10
+#define MS5611_TENDENCY_SLOW 150
+#define MS5611_TENDENCY_MODERATE 350
+#define MS5611_TENDENCY_QUICK 600
+
+    enum MS5611_tendency {
+        FALLING_VERY_RAPIDLY = -4,
+        FALLING_QUICKLY      = -3,
+        FALLING              = -2,
+        FALLING_SLOWLY       = -1,
+        STEADY               = 0,
+        RISING_SLOWLY        = 1,
+        RISING               = 2,
+        RISING_QUICKLY       = 3,
+        RISING_VERY_RAPIDLY  = 4
+    };
+
+/**
+ * Pressure tendency as the least-squares slope over a sliding time window, e.g. the 3 hour tendency of
+ * a weather station fed with one sample every few minutes.
+ *
+ * Timestamps and the window are in milliseconds, the unit of MS5611Sample.timestamp throughout the
+ * library, so `onSample` can subscribe to an MS5611Dispatcher fed by MS5611Scheduler or any other source
+ * of samples.
+ *
+ * The regression sums Σt, Σp, Σt², Σtp are updated as samples enter and leave a ring buffer of up to N
+ * samples, so a sample costs amortized O(1) and the slope never rescans history. Times are whole seconds
+ * relative to the oldest sample in the window; when it leaves, the sums are shifted to the new origin in
+ * O(1), so millis() wrap-around is harmless and the sums stay small. Pressures are relative to the first
+ * sample after the window was last empty. Samples can be irregular; with more than N samples per window
+ * the oldest are dropped early and the slope covers a shorter span.
+ */
+template <uint16_t N>
+class MS5611Tendency {
+public:
+    MS5611Tendency() {
+        begin();
+    }
+
+    void begin(uint32_t window = MS5611_TENDENCY_WINDOW) {
+        this->window = window;
+        reset();
+    }
+
+    void reset(void) {
+        count = 0;
+        tail = 0;
+        sumTime = 0;
+        sumPressure = 0;
+        sumTimeSquares = 0;
+        sumProducts = 0;
+    }
+
+    void push(uint32_t timestamp, int32_t pressure) {
+        while(count > 0 && timestamp - timestamps[tail] > window) {
+            removeOldest();
+        }
+        if(count == N) {
+            removeOldest();
+        }
+
+        if(count == 0) {
+            reset();
+            origin = timestamp;
+            reference = pressure;
+        } else {
+            rebase();
+        }
+
+        uint16_t head = (tail + count) % N;
+        timestamps[head] = timestamp;
+        pressures[head] = pressure;
+        count++;
+
+        int64_t time = (timestamp - origin) / 1000;
+        int64_t offset = (int64_t)pressure - reference;
+        sumTime += time;
+        sumPressure += offset;
+        sumTimeSquares += time * time;
+        sumProducts += time * offset;
+    }
+
+    static void onSample(const MS5611Sample &sample, void *context) {
+        ((MS5611Tendency<N> *)context)->push(sample.timestamp, sample.pressure);
+    }
+
+    uint16_t getCount(void) {
+        return count;
+    }
+
+    uint32_t getSpan(void) {
+        return count > 0 ? timestamps[(tail + count - 1) % N] - timestamps[tail] : 0;
+    }
+
+    int32_t getSlope(uint32_t period = 10800) {
+        int64_t denominator = (int64_t)count * sumTimeSquares - sumTime * sumTime;
+        if(count < 2 || denominator <= 0) {
+            return 0;
+        }
+        int64_t numerator = (int64_t)count * sumProducts - sumTime * sumPressure;
+        return (int32_t)(numerator * period / denominator);
+    }
+
+    MS5611_tendency getTendency(void) {
+        int32_t slope = getSlope();
+        int32_t magnitude = slope >= 0 ? slope : -slope;
+        int8_t level;
+        if(magnitude < MS5611_TENDENCY_STEADY) {
+            level = 0;
+        } else if(magnitude < MS5611_TENDENCY_SLOW) {
+            level = 1;
+        } else if(magnitude < MS5611_TENDENCY_MODERATE) {
+            level = 2;
+        } else if(magnitude < MS5611_TENDENCY_QUICK) {
+            level = 3;
+        } else {
+            level = 4;
+        }
+        return (MS5611_tendency)(slope >= 0 ? level : -level);
+    }
+private:
+    uint32_t timestamps[N];
+    int32_t pressures[N];
+    uint16_t count;
+    uint16_t tail;
+    uint32_t window;
+    uint32_t origin;
+    int32_t reference;
+    int64_t sumTime;
+    int64_t sumPressure;
+    int64_t sumTimeSquares;
+    int64_t sumProducts;
+
+    void removeOldest(void) {
+        int64_t time = (timestamps[tail] - origin) / 1000;
+        int64_t offset = (int64_t)pressures[tail] - reference;
+        sumTime -= time;
+        sumPressure -= offset;
+        sumTimeSquares -= time * time;
+        sumProducts -= time * offset;
+        tail = (tail + 1) % N;
+        count--;
+    }
+
+    void rebase(void) {
+        int64_t shift = (timestamps[tail] - origin) / 1000;
+        if(shift == 0) {
+            return;
+        }
+        sumTimeSquares -= 2 * shift * sumTime - (int64_t)count * shift * shift;
+        sumProducts -= shift * sumPressure;
+        sumTime -= (int64_t)count * shift;
+        origin += (uint32_t)shift * 1000;
+    }
+};
+
+#endif
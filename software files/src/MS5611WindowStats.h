@@ -0,0 +1,137 @@
+#ifndef MS5611WindowStats_h
+#define MS5611WindowStats_h
+
+#include "Arduino.h"
+
+/**
+ * Sliding window statistics over the last N samples, e.g. compensated pressure in Pa.
+ *
+ * Mean and variance come from running sums, minimum and maximum from monotonic deques, so every update
+ * costs amortized O(1) and memory is fixed at compile time. Sums are kept relative to the first sample
+ * after a reset, which keeps them exact in 64-bit arithmetic as long as samples stay within ±2^31 / N of it.
+ */
+template <uint16_t N>
+class MS5611WindowStats {
+public:
+    MS5611WindowStats() {
+        reset();
+    }
+
+    void reset(void) {
+        count = 0;
+        head = 0;
+        sequence = 0;
+        sum = 0;
+        sumSquares = 0;
+        minimumHead = 0;
+        minimumCount = 0;
+        maximumHead = 0;
+        maximumCount = 0;
+    }
+
+    void push(int32_t value) {
+        if(count == 0 && sequence == 0) {
+            reference = value;
+        }
+
+        int64_t offset = (int64_t)value - reference;
+        if(count == N) {
+            int64_t expired = (int64_t)values[head] - reference;
+            sum -= expired;
+            sumSquares -= expired * expired;
+        } else {
+            count++;
+        }
+        values[head] = value;
+        head = (head + 1) % N;
+        sum += offset;
+        sumSquares += offset * offset;
+
+        uint32_t oldest = sequence - count + 1;
+        pushDeque(minimumSequence, minimumValue, minimumHead, minimumCount, value, oldest, false);
+        pushDeque(maximumSequence, maximumValue, maximumHead, maximumCount, value, oldest, true);
+        sequence++;
+    }
+
+    uint16_t getCount(void) {
+        return count;
+    }
+
+    bool isFull(void) {
+        return count == N;
+    }
+
+    int32_t getMean(void) {
+        if(count == 0) {
+            return 0;
+        }
+        int64_t half = sum >= 0 ? count / 2 : -(int64_t)(count / 2);
+        return (int32_t)(reference + (sum + half) / count);
+    }
+
+    uint32_t getVariance(void) {
+        if(count == 0) {
+            return 0;
+        }
+        int64_t variance = (sumSquares * count - sum * sum) / ((int64_t)count * count);
+        return variance > 0xFFFFFFFFLL ? 0xFFFFFFFFUL : (uint32_t)variance;
+    }
+
+    uint32_t getStandardDeviation(void) {
+        uint32_t variance = getVariance();
+        uint32_t root = 0;
+        for(uint32_t bit = 1UL << 30; bit > 0; bit >>= 2) {
+            if(variance >= root + bit) {
+                variance -= root + bit;
+                root = (root >> 1) + bit;
+            } else {
+                root >>= 1;
+            }
+        }
+        return root;
+    }
+
+    int32_t getMinimum(void) {
+        return minimumCount > 0 ? minimumValue[minimumHead] : 0;
+    }
+
+    int32_t getMaximum(void) {
+        return maximumCount > 0 ? maximumValue[maximumHead] : 0;
+    }
+private:
+    int32_t values[N];
+    uint32_t minimumSequence[N];
+    uint32_t maximumSequence[N];
+    int32_t minimumValue[N];
+    int32_t maximumValue[N];
+    uint16_t count;
+    uint16_t head;
+    uint16_t minimumHead;
+    uint16_t minimumCount;
+    uint16_t maximumHead;
+    uint16_t maximumCount;
+    uint32_t sequence;
+    int32_t reference;
+    int64_t sum;
+    int64_t sumSquares;
+
+    void pushDeque(uint32_t *dequeSequence, int32_t *dequeValue, uint16_t &dequeHead, uint16_t &dequeCount, int32_t value, uint32_t oldest, bool maximum) {
+        while(dequeCount > 0 && (int32_t)(dequeSequence[dequeHead] - oldest) < 0) {
+            dequeHead = (dequeHead + 1) % N;
+            dequeCount--;
+        }
+        while(dequeCount > 0) {
+            int32_t last = dequeValue[(dequeHead + dequeCount - 1) % N];
+            if(maximum ? last > value : last < value) {
+                break;
+            }
+            dequeCount--;
+        }
+        uint16_t tail = (dequeHead + dequeCount) % N;
+        dequeSequence[tail] = sequence;
+        dequeValue[tail] = value;
+        dequeCount++;
+    }
+};
+
+#endif
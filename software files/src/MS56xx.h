@@ -0,0 +1,57 @@
+#ifndef MS56xx_h
+#define MS56xx_h
+
+#include "Arduino.h"
+#include "MS5611.h"
+#include "MS5611Compensation.h"
+
+/**
+ * Driver for other members of the MS56xx family, selected by a policy from MS5611Compensation.h.
+ *
+ * Calls made directly on an MS56xx object use the compensation of its policy inlined at compile time,
+ * so the hot path is as specialized as a single-part driver. Code that only holds an MS5611 reference,
+ * such as MS5611Group or MS5611Scheduler, reaches the same formulas through the table installed in the
+ * base class; a plain MS5611 carries no such table and never takes the indirect call.
+ */
+template <class Policy>
+class MS56xx : public MS5611 {
+public:
+    MS56xx(uint8_t address = Policy::address, TwoWire &wire = Wire) : MS5611(address, wire) {
+        setCompensation(&policyFormulas);
+    }
+
+    int32_t compensateTemperature(uint32_t D2, bool compensation = false) {
+        return MS5611Compensation<Policy>::temperature(filterCoefficient, D2, compensation);
+    }
+
+    int32_t compensatePressure(uint32_t D1, uint32_t D2, bool compensation = false) {
+        return MS5611Compensation<Policy>::pressure(filterCoefficient, D1, D2, compensation);
+    }
+
+#ifndef MS5611_NO_FLOAT
+    double readTemperature(bool compensation = false) {
+        return ((double)compensateTemperature(readRawTemperature(), compensation) / 100);
+    }
+#endif
+
+    int32_t readPressure(bool compensation = false) {
+        uint32_t D1 = readRawPressure();
+        uint32_t D2 = readRawTemperature();
+        return compensatePressure(D1, D2, compensation);
+    }
+
+private:
+    static const MS5611CompensationFormulas policyFormulas;
+};
+
+template <class Policy>
+const MS5611CompensationFormulas MS56xx<Policy>::policyFormulas = {
+    &MS5611Compensation<Policy>::temperature,
+    &MS5611Compensation<Policy>::pressure
+};
+
+typedef MS56xx<MS5607Policy> MS5607;
+typedef MS56xx<MS5637Policy> MS5637;
+typedef MS56xx<MS5803Policy> MS5803;
+
+#endif